@@ -0,0 +1,121 @@
+#include <aid/mpsc/mpsc.hpp>
+#include <benchmark/benchmark.h>
+#include <thread>
+#include <vector>
+
+using namespace aid::mpsc;
+
+namespace
+{
+/**
+ * Push/pop round trips on the mutex-based MpscQueue with a configurable number of
+ * producer threads hammering one consumer. The reported rate is messages per second
+ * seen by the consumer.
+ */
+void BM_MpscQueuePushPop(benchmark::State &state)
+{
+    constexpr int per_iteration = 10000;
+    auto producers = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        MpscQueue<int> queue;
+        std::vector<std::thread> threads;
+        threads.reserve(producers);
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue] {
+                for (int i = 0; i < per_iteration; ++i) {
+                    auto value = i;
+                    benchmark::DoNotOptimize(queue.push(std::move(value)));
+                }
+            });
+        }
+        int received = 0;
+        while (received < producers * per_iteration) {
+            auto res = queue.pop();
+            if (res.isOk()) {
+                benchmark::DoNotOptimize(res.value());
+                ++received;
+            }
+        }
+        for (auto &t : threads) { t.join(); }
+    }
+    state.SetItemsProcessed(state.iterations() * producers * per_iteration);
+}
+
+/**
+ * Same producer/consumer matrix on the lock-free MPSC backend, so the two queue
+ * implementations can be compared per commit.
+ */
+void BM_LockFreeMpscQueuePushPop(benchmark::State &state)
+{
+    constexpr int per_iteration = 10000;
+    auto producers = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        LockFreeMpscQueue<int> queue;
+        std::vector<std::thread> threads;
+        threads.reserve(producers);
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue] {
+                for (int i = 0; i < per_iteration; ++i) {
+                    auto value = i;
+                    benchmark::DoNotOptimize(queue.push(std::move(value)));
+                }
+            });
+        }
+        int received = 0;
+        while (received < producers * per_iteration) {
+            auto res = queue.pop();
+            if (res.isOk()) {
+                benchmark::DoNotOptimize(res.value());
+                ++received;
+            }
+        }
+        for (auto &t : threads) { t.join(); }
+    }
+    state.SetItemsProcessed(state.iterations() * producers * per_iteration);
+}
+
+/// Cost of creating a connected Sender/Receiver pair.
+void BM_ChannelCreation(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto pair = channel<int>();
+        benchmark::DoNotOptimize(pair);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Ping-pong latency of recv_blocking under a given backoff policy: one producer
+ * sends, the consumer answers on a reverse channel, both blocking. Comparing the
+ * per-item time and the CPU time across the three policies gives the latency/CPU
+ * tradeoff curve used to pick a policy per deployment.
+ */
+template<typename Backoff>
+void BM_BackoffPingPong(benchmark::State &state)
+{
+    constexpr int per_iteration = 1000;
+    for (auto _ : state) {
+        auto [tx, rx] = channel<int, ChannelType::UnboundedLockFree, Backoff>();
+        auto [reply_tx, reply_rx] = channel<int, ChannelType::UnboundedLockFree, Backoff>();
+        auto echo = std::thread([rx = std::move(rx), reply_tx]() mutable {
+            for (int i = 0; i < per_iteration; ++i) {
+                auto res = rx.recv_blocking();
+                benchmark::DoNotOptimize(reply_tx.send(res.value()));
+            }
+        });
+        for (int i = 0; i < per_iteration; ++i) {
+            benchmark::DoNotOptimize(tx.send(int{i}));
+            benchmark::DoNotOptimize(reply_rx.recv_blocking());
+        }
+        echo.join();
+    }
+    state.SetItemsProcessed(state.iterations() * per_iteration);
+}
+
+BENCHMARK(BM_MpscQueuePushPop)->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
+BENCHMARK(BM_LockFreeMpscQueuePushPop)->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
+BENCHMARK(BM_ChannelCreation);
+BENCHMARK_TEMPLATE(BM_BackoffPingPong, SpinBackoff)->UseRealTime()->MeasureProcessCPUTime();
+BENCHMARK_TEMPLATE(BM_BackoffPingPong, YieldBackoff)->UseRealTime()->MeasureProcessCPUTime();
+BENCHMARK_TEMPLATE(BM_BackoffPingPong, AdaptiveBackoff)->UseRealTime()->MeasureProcessCPUTime();
+}// namespace
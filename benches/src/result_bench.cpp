@@ -0,0 +1,35 @@
+#include <aid/core/result.hpp>
+#include <benchmark/benchmark.h>
+
+using namespace aid::core;
+
+namespace
+{
+/// ns/op of a map chain over an Ok Result, the dominant shape in parsing pipelines.
+void BM_ResultMapChain(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto res = ok<int, int>(2)
+                       .map([](int &&v) { return v * 2; })
+                       .map([](int &&v) { return v + 1; })
+                       .map([](int &&v) { return v * 3; });
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+Result<int, int> step(int &&v) { return ok<int, int>(v + 1); }
+
+/// ns/op of an andThen chain where every step is itself fallible.
+void BM_ResultAndThenChain(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto res = ok<int, int>(0).andThen(step).andThen(step).andThen(step).andThen(step);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ResultMapChain);
+BENCHMARK(BM_ResultAndThenChain);
+}// namespace
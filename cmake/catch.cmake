@@ -9,4 +9,4 @@ FetchContent_Declare(
 FetchContent_MakeAvailable(Catch2)
 list(APPEND CMAKE_MODULE_PATH ${catch2_SOURCE_DIR}/contrib)
 include(CTest)
-include(Catch)
\ No newline at end of file
+include(Catch)
@@ -8,4 +8,4 @@ doxygen_add_docs(aid_docs
         ${PROJECT_SOURCE_DIR}/include
         ${PROJECT_SOURCE_DIR}/tests
 
-)
\ No newline at end of file
+)
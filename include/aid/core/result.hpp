@@ -1,8 +1,11 @@
 #ifndef AID_INCLUDE_AID_CORE_RESULT_HPP
 #define AID_INCLUDE_AID_CORE_RESULT_HPP
 
-#include <iostream>
+#include <aid/core/result_fail.hpp>
 #include <optional>
+#include <ostream>
+#include <type_traits>
+#include <variant>
 
 namespace aid::core
 {
@@ -10,15 +13,24 @@ namespace aid::core
 template<typename Ok, typename Err>
 class Result;
 
-template<typename Ok, typename Err>
-auto ok(Ok &&value) -> Result<Ok, Err>;
+template<typename Ok, typename Err, std::enable_if_t<!std::is_void_v<Ok>, bool> = true>
+constexpr auto ok(Ok &&value) -> Result<Ok, Err>;
 
-template<typename Ok, typename Err>
-auto err(Err &&value) -> Result<Ok, Err>;
+template<typename Ok, typename Err, std::enable_if_t<!std::is_void_v<Ok>, bool> = true>
+constexpr auto err(Err &&value) -> Result<Ok, Err>;
+
+template<typename Ok, typename Err, std::enable_if_t<std::is_void_v<Ok>, bool> = true>
+constexpr auto ok() -> Result<void, Err>;
+
+template<typename Ok, typename Err, std::enable_if_t<std::is_void_v<Ok>, bool> = true>
+constexpr auto err(Err &&value) -> Result<void, Err>;
 
 /**
  * Result that represent either a success (Ok) or a failure (Err).
  *
+ * Internally the Result stores a single payload slot next to a discriminating tag,
+ * so sizeof(Result<Ok, Err>) is on the order of max(sizeof(Ok), sizeof(Err)) plus the tag
+ * instead of the sum of both sides.
  *
  * @tparam Ok success value type
  * @tparam Err error value type
@@ -26,6 +38,13 @@ auto err(Err &&value) -> Result<Ok, Err>;
 template<typename Ok, typename Err>
 class Result
 {
+    // Index 0 marks a consumed Result, index 1 holds the Ok value and index 2 the Err value.
+    // The Ok and Err types are allowed to be identical, so the storage is always addressed by index.
+    using Storage = std::variant<std::monostate, Ok, Err>;
+    static constexpr std::size_t EmptyIndex = 0;
+    static constexpr std::size_t OkIndex = 1;
+    static constexpr std::size_t ErrIndex = 2;
+
 public:
     using OkType [[maybe_unused]] = Ok;
     using ErrType [[maybe_unused]] = Err;
@@ -39,21 +58,9 @@ public:
      * @param ok optional Ok value
      * @param err optional error value
      */
-    explicit Result(std::optional<Ok> ok, std::optional<Err> err)
-    {
-        auto has_ok = ok.has_value();
-        auto has_err = err.has_value();
-        if (has_ok && has_err) {
-            std::clog << "Trying to construct a Result with both an Ok and Err value." << std::endl;
-            std::exit(1);
-        }
-        if (!has_ok && !has_err) {
-            std::clog << "Trying to construct a Result without an Ok or an Err value." << std::endl;
-            std::exit(1);
-        }
-        Oke = ok;
-        Erre = err;
-    }
+    constexpr explicit Result(std::optional<Ok> ok, std::optional<Err> err)
+        : Store{makeStorage(std::move(ok), std::move(err))}
+    {}
 
     Result(const Result &) = delete;
 
@@ -61,7 +68,7 @@ public:
      * Move the data from another Result into a new instance.
      * @param other result being moved
      */
-    Result(Result &&other) noexcept
+    Result(Result &&other) noexcept(std::is_nothrow_move_constructible_v<Ok> && std::is_nothrow_move_constructible_v<Err>)
     {
         *this = std::move(other);
     }
@@ -73,18 +80,17 @@ public:
      * @param other result being moved
      * @return Result
      */
-    Result &operator=(Result &&other) noexcept
+    Result &operator=(Result &&other) noexcept(std::is_nothrow_move_constructible_v<Ok> && std::is_nothrow_move_constructible_v<Err>)
     {
         if (this != &other) {
-            Oke = std::move(other.Oke);
-            Erre = std::move(other.Erre);
+            Store = std::move(other.Store);
         }
         return *this;
     }
 
     bool operator==(const Result &rhs) const
     {
-        return Oke == rhs.Oke && Erre == rhs.Erre;
+        return Store == rhs.Store;
     }
 
     bool operator!=(const Result &rhs) const
@@ -96,17 +102,17 @@ public:
      * Check if a value i stored inside the Result.
      * @return True if a value is stored inside the Result.
      */
-    [[nodiscard]] bool isOk() const
+    [[nodiscard]] constexpr bool isOk() const noexcept
     {
-        return Oke.has_value();
+        return Store.index() == OkIndex;
     }
     /**
      * Check if an error is stored inside the Result.
      * @return True if an error is stored inside the Result.
      */
-    [[nodiscard]] bool isErr() const
+    [[nodiscard]] constexpr bool isErr() const noexcept
     {
-        return Erre.has_value();
+        return Store.index() == ErrIndex;
     }
 
     /**
@@ -123,18 +129,41 @@ public:
      * @return A new Result with the result of the applied function f or an error if that was initially present.
      */
     template<typename Func>
-    [[nodiscard]] auto map(Func &&F) -> Result<std::result_of_t<Func && (Ok &&)>, Err>
+    [[nodiscard]] constexpr auto map(Func &&F) -> Result<std::result_of_t<Func && (Ok &&)>, Err>
     {
 
         if (isOk()) {
-            return Result<std::result_of_t<Func && (Ok &&)>, Err>(std::move(F(std::move(*Oke))), {});
+            return Result<std::result_of_t<Func && (Ok &&)>, Err>(std::move(F(std::move(std::get<OkIndex>(Store)))), {});
         }
         else if (isErr()) {
-            return Result<std::result_of_t<Func && (Ok &&)>, Err>({}, std::move(*Erre));
+            return Result<std::result_of_t<Func && (Ok &&)>, Err>({}, std::move(std::get<ErrIndex>(Store)));
         }
         else {
-            std::clog << "Trying to apply a map function to a Result that has no value and no error." << std::endl;
-            std::exit(1);
+            detail::resultFail("Trying to apply a map function to a Result that has no value and no error.");
+        }
+    }
+
+    /**
+     * Maps a Result<Ok, Err> to Result<Func(const Ok&), Err> by applying a function F to the contained Ok value.
+     *
+     * The Result is left untouched: F reads the stored value through a const reference
+     * and a stored Err is copied into the new Result, so this overload suits
+     * read-mostly pipeline stages that keep the original Result alive.
+     * @tparam Func Function type being applied to the stored Ok value.
+     * @param F function being applied to the stored Ok value
+     * @return A new Result with the result of the applied function F or a copy of the stored error.
+     */
+    template<typename Func>
+    [[nodiscard]] constexpr auto map(Func &&F) const -> Result<std::result_of_t<Func && (const Ok &)>, Err>
+    {
+        if (isOk()) {
+            return Result<std::result_of_t<Func && (const Ok &)>, Err>(F(std::get<OkIndex>(Store)), {});
+        }
+        else if (isErr()) {
+            return Result<std::result_of_t<Func && (const Ok &)>, Err>({}, std::get<ErrIndex>(Store));
+        }
+        else {
+            detail::resultFail("Trying to apply a map function to a Result that has no value and no error.");
         }
     }
 
@@ -155,14 +184,13 @@ public:
     [[nodiscard]] auto mapErr(Func &&F) -> Result<Ok, std::result_of_t<Func && (Err &&)>>
     {
         if (isOk()) {
-            return Result<Ok, std::result_of_t<Func && (Err &&)>>{std::move(*Oke), {}};
+            return Result<Ok, std::result_of_t<Func && (Err &&)>>{std::move(std::get<OkIndex>(Store)), {}};
         }
         else if (isErr()) {
-            return Result<Ok, std::result_of_t<Func && (Err &&)>>{{}, std::move(F(std::move(*Erre)))};
+            return Result<Ok, std::result_of_t<Func && (Err &&)>>{{}, std::move(F(std::move(std::get<ErrIndex>(Store))))};
         }
         else {
-            std::clog << "Trying to apply a mapErr function to a Result that has no value and no error." << std::endl;
-            std::exit(1);
+            detail::resultFail("Trying to apply a mapErr function to a Result that has no value and no error.");
         }
     }
 
@@ -182,7 +210,7 @@ public:
     [[nodiscard]] auto mapOr(U &&Default, Func &&F) -> U
     {
         if (isOk()) {
-            return std::move(F(std::move(*Oke)));
+            return std::move(F(std::move(std::get<OkIndex>(Store))));
         }
         return std::forward<U>(Default);
     }
@@ -210,9 +238,9 @@ public:
     [[nodiscard]] auto mapOrElse(DefaultFunc &&Df, Func &&F) -> std::result_of_t<Func && (Ok &&)>
     {
         if (isOk()) {
-            return std::move(F(std::move(*Oke)));
+            return std::move(F(std::move(std::get<OkIndex>(Store))));
         }
-        return std::move(Df(std::move(*Erre)));
+        return std::move(Df(std::move(std::get<ErrIndex>(Store))));
     }
 
     /**
@@ -230,7 +258,7 @@ public:
         if (isOk()) {
             return std::move(Res);
         }
-        return ::aid::core::err<U, Err>(std::move(*Erre));
+        return ::aid::core::err<U, Err>(std::move(std::get<ErrIndex>(Store)));
     }
 
     /**
@@ -244,12 +272,12 @@ public:
      * @return If this Result stores an Ok value, F is applied to that value, otherwise Err of this instance is returned.
      */
     template<typename Func, typename R = std::result_of_t<Func && (Ok &&)>>
-    [[nodiscard]] auto andThen(Func &&F) -> R
+    [[nodiscard]] constexpr auto andThen(Func &&F) -> R
     {
         if (isOk()) {
-            return F(std::move(*Oke));
+            return F(std::move(std::get<OkIndex>(Store)));
         }
-        return ::aid::core::err<Ok, typename R::ErrType>(std::move(*Erre));
+        return ::aid::core::err<Ok, typename R::ErrType>(std::move(std::get<ErrIndex>(Store)));
     }
 
     /**
@@ -259,10 +287,10 @@ public:
      * @return True if the Result contains an Ok value that is equal to x.
      */
     template<typename U>
-    [[nodiscard]] auto contains(const U &x) -> bool
+    [[nodiscard]] constexpr auto contains(const U &x) const -> bool
     {
         if (isOk()) {
-            auto value = Oke.value();
+            auto value = std::get<OkIndex>(Store);
             if (value == x) return true;
         }
         return false;
@@ -275,10 +303,10 @@ public:
      * @return True if the Result contains an Err value that is equal to x.
      */
     template<typename U>
-    [[nodiscard]] auto containsErr(const U &x) -> bool
+    [[nodiscard]] constexpr auto containsErr(const U &x) const -> bool
     {
         if (isErr()) {
-            auto value = Erre.value();
+            auto value = std::get<ErrIndex>(Store);
             if (value == x) return true;
         }
         return false;
@@ -297,7 +325,7 @@ public:
     [[nodiscard]] auto ore(Result<Ok, U> &&Res) -> Result<Ok, U>
     {
         if (isOk()) {
-            return ok<Ok, U>(std::move(*Oke));
+            return ok<Ok, U>(std::move(std::get<OkIndex>(Store)));
         }
         return std::move(Res);
     }
@@ -306,49 +334,138 @@ public:
     [[nodiscard]] auto orElse(Func &&F) -> R
     {
         if (isOk()) {
-            //            using R = std::result_of_t<Func&&(Err&&)>;
-            return R(std::move(*Oke), {});
+            return R(std::move(std::get<OkIndex>(Store)), {});
+        }
+        return std::move(F(std::move(std::get<ErrIndex>(Store))));
+    }
+
+    /**
+     * Borrow the stored Ok value without consuming it.
+     *
+     * The function exits the application if no Ok value is stored in the Result.
+     * @return Reference to the stored Ok value.
+     */
+    [[nodiscard]] auto valueRef() -> Ok &
+    {
+        if (!isOk()) {
+            detail::resultFail("Trying to borrow the value of a result which doesn't have a value");
+        }
+        return std::get<OkIndex>(Store);
+    }
+
+    /**
+     * Borrow the stored Ok value without consuming it.
+     *
+     * The function exits the application if no Ok value is stored in the Result.
+     * @return Const reference to the stored Ok value.
+     */
+    [[nodiscard]] auto valueRef() const -> const Ok &
+    {
+        if (!isOk()) {
+            detail::resultFail("Trying to borrow the value of a result which doesn't have a value");
+        }
+        return std::get<OkIndex>(Store);
+    }
+
+    /**
+     * Borrow the stored Err value without consuming it.
+     *
+     * The function exits the application if no Err value is stored in the Result.
+     * @return Reference to the stored Err value.
+     */
+    [[nodiscard]] auto errRef() -> Err &
+    {
+        if (!isErr()) {
+            detail::resultFail("Trying to borrow the error of a result which doesn't have an error");
+        }
+        return std::get<ErrIndex>(Store);
+    }
+
+    /**
+     * Borrow the stored Err value without consuming it.
+     *
+     * The function exits the application if no Err value is stored in the Result.
+     * @return Const reference to the stored Err value.
+     */
+    [[nodiscard]] auto errRef() const -> const Err &
+    {
+        if (!isErr()) {
+            detail::resultFail("Trying to borrow the error of a result which doesn't have an error");
+        }
+        return std::get<ErrIndex>(Store);
+    }
+
+    /**
+     * Call F with a const reference to the stored Ok value, if one is present.
+     *
+     * The Result is left untouched, so read-mostly stages can observe a value
+     * without moving or copying the payload.
+     * @tparam Func Function type being applied to the stored Ok value.
+     * @param F function receiving const Ok&
+     * @return This Result, for chaining.
+     */
+    template<typename Func>
+    auto inspect(Func &&F) const -> const Result &
+    {
+        if (isOk()) {
+            F(std::get<OkIndex>(Store));
+        }
+        return *this;
+    }
+
+    /**
+     * Call F with a const reference to the stored Err value, if one is present.
+     *
+     * The Result is left untouched.
+     * @tparam Func Function type being applied to the stored Err value.
+     * @param F function receiving const Err&
+     * @return This Result, for chaining.
+     */
+    template<typename Func>
+    auto inspectErr(Func &&F) const -> const Result &
+    {
+        if (isErr()) {
+            F(std::get<ErrIndex>(Store));
         }
-        return std::move(F(std::move(*Erre)));
+        return *this;
     }
 
     /**
      * Get the contained Ok value, consuming itself.
      *
-     * The internal Ok value is set to an empty optional.
+     * The internal storage is reset to the consumed state.
      * The function exits the application if no Ok value is stored in the Result.
      * @return Ok value
      */
     Ok value()
     {
-        if (!Oke.has_value()) {
-            std::clog << "Trying to get the value of a result which doesn't have a value" << std::endl;
-            std::exit(1);
+        if (!isOk()) {
+            detail::resultFail("Trying to get the value of a result which doesn't have a value");
         }
         // move the internal value into a temporary.
-        auto tmp = std::move(*Oke);
-        // reinitialise the internal ok value to an empty optional.
-        Oke = std::optional<Ok>{};
-        return std::move(tmp);
+        auto tmp = std::move(std::get<OkIndex>(Store));
+        // reinitialise the internal storage to the consumed state.
+        Store.template emplace<EmptyIndex>();
+        return tmp;
     }
 
     /**
      * Get the contained Ok value, if it exists, otherwise return the default value.
      *
-     * The internal Ok value is set to an empty optional.
+     * The internal storage is reset to the consumed state.
      * @param Default default provided value if no Ok value is present.
      * @return Returns the Ok value if it exists, otherwise return the default value.
      */
     Ok valueOr(Ok Default)
     {
-        if (!Oke.has_value()) {
+        if (!isOk()) {
             return Default;
         }
         // move the internal value into a temporary.
-        auto tmp = std::move(*Oke);
-        // reinitialise the internal ok value to an empty optional.
-        Oke = std::optional<Ok>{};
-        return std::move(tmp);
+        auto tmp = std::move(std::get<OkIndex>(Store));
+        // reinitialise the internal storage to the consumed state.
+        Store.template emplace<EmptyIndex>();
+        return tmp;
     }
 
     /**
@@ -359,10 +476,9 @@ public:
     auto expect(const char *msg) -> Ok
     {
         if (isOk()) {
-            return std::move(*Oke);
+            return std::move(std::get<OkIndex>(Store));
         }
-        std::clog << msg << std::endl;
-        std::exit(1);
+        detail::resultFail(msg);
     }
 
     /**
@@ -370,83 +486,411 @@ public:
      * @param msg passed message in case no Err value is stored in the Result
      * @return Returns an Err value stored inside the Result.
      */
-    auto expectErr(const char *msg) -> Ok
+    auto expectErr(const char *msg) -> Err
     {
         if (isErr()) {
-            return std::move(*Erre);
+            return std::move(std::get<ErrIndex>(Store));
         }
-        std::clog << msg << std::endl;
-        std::exit(1);
+        detail::resultFail(msg);
     }
 
     /**
      * Get the contained Err value, consuming itself.
      *
-     * The internal Err value is set to an empty optional.
+     * The internal storage is reset to the consumed state.
      * The function exits the application if no Err value is stored in the Result.
      * @return Ok value
      */
     Err err()
     {
-        if (!Erre.has_value()) {
-            std::clog << "Trying to get the error of a result which doesn't have an error" << std::endl;
-            std::exit(1);
+        if (!isErr()) {
+            detail::resultFail("Trying to get the error of a result which doesn't have an error");
         }
         // move the internal value into a temporary.
-        auto tmp = std::move(*Erre);
-        // reinitialise the internal err value to an empty optional.
-        Erre = std::optional<Err>{};
-        return std::move(tmp);
+        auto tmp = std::move(std::get<ErrIndex>(Store));
+        // reinitialise the internal storage to the consumed state.
+        Store.template emplace<EmptyIndex>();
+        return tmp;
     }
 
     /**
      * Get the contained Err value, if it exists, otherwise return the default value.
      *
-     * The internal Err value is set to an empty optional.
+     * The internal storage is reset to the consumed state.
      * @param default_value default provided value if no Err value is present.
      * @return Returns the Err value if it exists, otherwise return the default value.
      */
     Err errOr(Err default_value)
     {
-        if (!Erre.has_value()) {
+        if (!isErr()) {
             return default_value;
         }
         // move the internal value into a temporary.
-        auto tmp = std::move(*Erre);
-        // reinitialise the internal err value to an empty optional.
-        Erre = std::optional<Err>{};
-        return std::move(tmp);
+        auto tmp = std::move(std::get<ErrIndex>(Store));
+        // reinitialise the internal storage to the consumed state.
+        Store.template emplace<EmptyIndex>();
+        return tmp;
     }
 
-    template<typename T, typename E>
-    friend Result<T, E> ok(T &&value);
-
-    template<typename T, typename E>
-    friend Result<T, E> err(T &&value);
-
     template<typename O, typename E>
     friend std::ostream &operator<<(std::ostream &os, const Result<O, E> &r);
 
 
 private:
-    std::optional<Ok> Oke;
-    std::optional<Err> Erre;
+    /**
+     * Validate and build the storage for the optional-based constructor.
+     *
+     * The misuse branches call into the cold failure funnel at runtime; during constant evaluation
+     * they are ill-formed, so a compile-time Result can never be constructed in an
+     * invalid state.
+     */
+    static constexpr auto makeStorage(std::optional<Ok> ok, std::optional<Err> err) -> Storage
+    {
+        auto has_ok = ok.has_value();
+        auto has_err = err.has_value();
+        if (has_ok && has_err) {
+            detail::resultFail("Trying to construct a Result with both an Ok and Err value.");
+        }
+        if (!has_ok && !has_err) {
+            detail::resultFail("Trying to construct a Result without an Ok or an Err value.");
+        }
+        if (has_ok) {
+            return Storage{std::in_place_index<OkIndex>, std::move(*ok)};
+        }
+        return Storage{std::in_place_index<ErrIndex>, std::move(*err)};
+    }
+
+    Storage Store;
 };
 
+
 /**
- * Create an Oke result with a value.
+ * Result specialization for status-only APIs: the Ok state carries no payload.
+ *
+ * The Ok state is nothing but the discriminating tag, so a successful status return
+ * constructs no payload and sizeof(Result<void, Err>) is on the order of sizeof(Err)
+ * plus the tag.
+ *
+ * @tparam Err error value type
+ */
+template<typename Err>
+class Result<void, Err>
+{
+    // Index 0 marks a consumed Result, index 1 the payload-free Ok state and index 2
+    // the Err value, mirroring the index layout of the primary template.
+    using Storage = std::variant<std::monostate, std::monostate, Err>;
+    static constexpr std::size_t EmptyIndex = 0;
+    static constexpr std::size_t OkIndex = 1;
+    static constexpr std::size_t ErrIndex = 2;
+
+public:
+    using OkType [[maybe_unused]] = void;
+    using ErrType [[maybe_unused]] = Err;
+
+    /**
+     * Construct a result from an optional error.
+     *
+     * An empty optional produces the Ok state; since the Ok state has no payload there
+     * is no invalid combination to validate.
+     * @param err optional error value
+     */
+    constexpr explicit Result(std::optional<Err> err)
+        : Store{err.has_value()
+                    ? Storage{std::in_place_index<ErrIndex>, std::move(*err)}
+                    : Storage{std::in_place_index<OkIndex>}}
+    {}
+
+    Result(const Result &) = delete;
+
+    /**
+     * Move the data from another Result into a new instance.
+     * @param other result being moved
+     */
+    Result(Result &&other) noexcept(std::is_nothrow_move_constructible_v<Err>)
+    {
+        *this = std::move(other);
+    }
+
+    Result &operator=(const Result &) = delete;
+
+    /**
+     * Move the data from another Result into this instance.
+     * @param other result being moved
+     * @return Result
+     */
+    Result &operator=(Result &&other) noexcept(std::is_nothrow_move_constructible_v<Err>)
+    {
+        if (this != &other) {
+            Store = std::move(other.Store);
+        }
+        return *this;
+    }
+
+    bool operator==(const Result &rhs) const
+    {
+        return Store == rhs.Store;
+    }
+
+    bool operator!=(const Result &rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    /**
+     * Check if the Result holds the Ok state.
+     * @return True if the Result holds the Ok state.
+     */
+    [[nodiscard]] constexpr bool isOk() const noexcept
+    {
+        return Store.index() == OkIndex;
+    }
+    /**
+     * Check if an error is stored inside the Result.
+     * @return True if an error is stored inside the Result.
+     */
+    [[nodiscard]] constexpr bool isErr() const noexcept
+    {
+        return Store.index() == ErrIndex;
+    }
+
+    /**
+     * Maps a Result<void, Err> to Result<Func(), Err> by calling F in the Ok state.
+     *
+     * Because data is moved internally, the behaviour of the Result after applying this function is undefined.
+     *
+     * If no value or error is stored in the Result, the function exits the application.
+     * @tparam Func Function type producing the Ok value of the new Result.
+     * @param F function called in the Ok state
+     * @return A new Result with the result of F or the error if one was initially present.
+     */
+    template<typename Func>
+    [[nodiscard]] constexpr auto map(Func &&F) -> Result<std::result_of_t<Func && ()>, Err>
+    {
+        if (isOk()) {
+            return Result<std::result_of_t<Func && ()>, Err>(std::move(F()), {});
+        }
+        else if (isErr()) {
+            return Result<std::result_of_t<Func && ()>, Err>({}, std::move(std::get<ErrIndex>(Store)));
+        }
+        else {
+            detail::resultFail("Trying to apply a map function to a Result that has no value and no error.");
+        }
+    }
+
+    /**
+     * Maps a Result<void, Err> to Result<void, Func(Err&&)> by applying a function F to the contained Err value.
+     *
+     * Because data is moved internally, the behaviour of the Result after applying this function is undefined.
+     * @tparam Func Function type being applied to the stored Err value.
+     * @param F function being applied to the stored Err value
+     * @return A new Result with either the Ok state or the result of the applied function F on the initial error.
+     */
+    template<typename Func>
+    [[nodiscard]] auto mapErr(Func &&F) -> Result<void, std::result_of_t<Func && (Err &&)>>
+    {
+        using U = std::result_of_t<Func && (Err &&)>;
+        if (isOk()) {
+            return Result<void, U>{std::optional<U>{}};
+        }
+        else if (isErr()) {
+            return Result<void, U>{std::optional<U>{std::move(F(std::move(std::get<ErrIndex>(Store))))}};
+        }
+        else {
+            detail::resultFail("Trying to apply a mapErr function to a Result that has no value and no error.");
+        }
+    }
+
+    /**
+     * Call F if this Result is Ok, otherwise carry the Err value into the returned Result.
+     *
+     * Because data is moved internally, the behaviour of the Result after applying this function is undefined.
+     * @tparam Func Function type called in the Ok state
+     * @tparam R Return type of F, a Result with an identical Err type as this instance.
+     * @param F Function called in the Ok state
+     * @return The Result produced by F or the Err of this instance.
+     */
+    template<typename Func, typename R = std::result_of_t<Func && ()>>
+    [[nodiscard]] constexpr auto andThen(Func &&F) -> R
+    {
+        if (isOk()) {
+            return F();
+        }
+        return ::aid::core::err<typename R::OkType, typename R::ErrType>(std::move(std::get<ErrIndex>(Store)));
+    }
+
+    /**
+     * Return true if the Result contains an Err value that is equal to x.
+     * @tparam U Type of the argument
+     * @param x check if this value is stored inside the Result
+     * @return True if the Result contains an Err value that is equal to x.
+     */
+    template<typename U>
+    [[nodiscard]] constexpr auto containsErr(const U &x) const -> bool
+    {
+        if (isErr()) {
+            auto value = std::get<ErrIndex>(Store);
+            if (value == x) return true;
+        }
+        return false;
+    }
+
+    /**
+     * Borrow the stored Err value without consuming it.
+     *
+     * The function exits the application if no Err value is stored in the Result.
+     * @return Reference to the stored Err value.
+     */
+    [[nodiscard]] auto errRef() -> Err &
+    {
+        if (!isErr()) {
+            detail::resultFail("Trying to borrow the error of a result which doesn't have an error");
+        }
+        return std::get<ErrIndex>(Store);
+    }
+
+    /**
+     * Borrow the stored Err value without consuming it.
+     *
+     * The function exits the application if no Err value is stored in the Result.
+     * @return Const reference to the stored Err value.
+     */
+    [[nodiscard]] auto errRef() const -> const Err &
+    {
+        if (!isErr()) {
+            detail::resultFail("Trying to borrow the error of a result which doesn't have an error");
+        }
+        return std::get<ErrIndex>(Store);
+    }
+
+    /**
+     * Call F with a const reference to the stored Err value, if one is present.
+     *
+     * The Result is left untouched.
+     * @tparam Func Function type being applied to the stored Err value.
+     * @param F function receiving const Err&
+     * @return This Result, for chaining.
+     */
+    template<typename Func>
+    auto inspectErr(Func &&F) const -> const Result &
+    {
+        if (isErr()) {
+            F(std::get<ErrIndex>(Store));
+        }
+        return *this;
+    }
+
+    /**
+     * Consume the Ok state.
+     *
+     * The internal storage is reset to the consumed state.
+     * The function exits the application if the Result holds an error.
+     */
+    void value()
+    {
+        if (!isOk()) {
+            detail::resultFail("Trying to get the value of a result which doesn't have a value");
+        }
+        Store.template emplace<EmptyIndex>();
+    }
+
+    /**
+     * Exit with a message unless the Result holds the Ok state.
+     * @param msg passed message in case an error is stored in the Result
+     */
+    void expect(const char *msg)
+    {
+        if (!isOk()) {
+            detail::resultFail(msg);
+        }
+    }
+
+    /**
+     * Returns an Err value stored inside the Result, otherwise log a message and exit.
+     * @param msg passed message in case no Err value is stored in the Result
+     * @return Returns an Err value stored inside the Result.
+     */
+    auto expectErr(const char *msg) -> Err
+    {
+        if (isErr()) {
+            return std::move(std::get<ErrIndex>(Store));
+        }
+        detail::resultFail(msg);
+    }
+
+    /**
+     * Get the contained Err value, consuming itself.
+     *
+     * The internal storage is reset to the consumed state.
+     * The function exits the application if no Err value is stored in the Result.
+     * @return Err value
+     */
+    Err err()
+    {
+        if (!isErr()) {
+            detail::resultFail("Trying to get the error of a result which doesn't have an error");
+        }
+        auto tmp = std::move(std::get<ErrIndex>(Store));
+        Store.template emplace<EmptyIndex>();
+        return tmp;
+    }
+
+    /**
+     * Get the contained Err value, if it exists, otherwise return the default value.
+     *
+     * The internal storage is reset to the consumed state.
+     * @param default_value default provided value if no Err value is present.
+     * @return Returns the Err value if it exists, otherwise return the default value.
+     */
+    Err errOr(Err default_value)
+    {
+        if (!isErr()) {
+            return default_value;
+        }
+        auto tmp = std::move(std::get<ErrIndex>(Store));
+        Store.template emplace<EmptyIndex>();
+        return tmp;
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const Result &r)
+    {
+        if (r.isOk()) {
+            os << "Ok{}";
+        }
+        if (r.isErr()) {
+            os << "Err{" << std::get<ErrIndex>(r.Store) << "}";
+        }
+        return os;
+    }
+
+private:
+    Storage Store;
+};
+
+/**
+ * Create an Ok result with a value.
  * @tparam Ok Value type of the Result
- * @tparam Err Erre type of the Result
+ * @tparam Err Err type of the Result
  * @param value data being moved inside the Result.
  * @return Result instance with a value.
  */
-template<typename Ok, typename Err>
-auto ok(Ok &&value) -> Result<Ok, Err>
+template<typename Ok, typename Err, std::enable_if_t<!std::is_void_v<Ok>, bool>>
+constexpr auto ok(Ok &&value) -> Result<Ok, Err>
 {
-    //    return Result<Oke, Erre>{std::optional{std::forward<Oke>(value)}, std::optional<Erre>()};
     return Result<Ok, Err>{std::optional{value}, std::optional<Err>{}};
 }
 
+/**
+ * Create an Ok result for a status-only Result<void, Err>.
+ * @tparam Ok Value type of the Result, void
+ * @tparam Err Err type of the Result
+ * @return Result instance in the payload-free Ok state.
+ */
+template<typename Ok, typename Err, std::enable_if_t<std::is_void_v<Ok>, bool>>
+constexpr auto ok() -> Result<void, Err>
+{
+    return Result<void, Err>{std::optional<Err>{}};
+}
+
 /**
  * Create an Err result with an error.
  * @tparam Ok Value type of the Result
@@ -454,23 +898,36 @@ auto ok(Ok &&value) -> Result<Ok, Err>
  * @param value error being moved inside the Result.
  * @return Result instance with an error.
  */
-template<typename Ok, typename Err>
-auto err(Err &&value) -> Result<Ok, Err>
+template<typename Ok, typename Err, std::enable_if_t<!std::is_void_v<Ok>, bool>>
+constexpr auto err(Err &&value) -> Result<Ok, Err>
 {
     return Result<Ok, Err>{std::optional<Ok>{}, std::optional<Err>{value}};
 }
 
+/**
+ * Create an Err result for a status-only Result<void, Err>.
+ * @tparam Ok Value type of the Result, void
+ * @tparam Err Err type of the Result
+ * @param value error being moved inside the Result.
+ * @return Result instance with an error.
+ */
+template<typename Ok, typename Err, std::enable_if_t<std::is_void_v<Ok>, bool>>
+constexpr auto err(Err &&value) -> Result<void, Err>
+{
+    return Result<void, Err>{std::optional<Err>{std::move(value)}};
+}
+
 template<typename O, typename E>
 std::ostream &operator<<(std::ostream &os, const Result<O, E> &r)
 {
     if (r.isOk()) {
         os << "Ok{";
-        os << r.Oke.value();
+        os << std::get<1>(r.Store);
         os << "}";
     }
     if (r.isErr()) {
         os << "Err{";
-        os << r.Erre.value();
+        os << std::get<2>(r.Store);
         os << "}";
     }
     return os;
@@ -0,0 +1,43 @@
+#ifndef AID_INCLUDE_AID_CORE_RESULT_FAIL_HPP
+#define AID_INCLUDE_AID_CORE_RESULT_FAIL_HPP
+
+#if defined(AID_RESULT_MINIMAL_ABORT)
+#include <cstdlib>
+#else
+#include <cstdlib>
+#include <iostream>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AID_RESULT_COLD __attribute__((cold, noinline))
+#else
+#define AID_RESULT_COLD
+#endif
+
+namespace aid::core::detail
+{
+/**
+ * Out-of-line failure funnel for Result misuse (consuming the wrong state,
+ * constructing an invalid Result, ...).
+ *
+ * The funnel is a single non-template function, so the several hundred distinct
+ * Result<Ok, Err> instantiations of a large binary all branch to one cold copy
+ * instead of each inlining logging code into their hot accessors. Defining
+ * AID_RESULT_MINIMAL_ABORT drops the message formatting entirely and aborts,
+ * which keeps iostream (and its static initialisation) out of the binary.
+ *
+ * @param msg description of the misuse, ignored in the minimal-abort mode
+ */
+[[noreturn]] AID_RESULT_COLD inline void resultFail(const char *msg)
+{
+#if defined(AID_RESULT_MINIMAL_ABORT)
+    static_cast<void>(msg);
+    std::abort();
+#else
+    std::clog << msg << std::endl;
+    std::exit(1);
+#endif
+}
+}// namespace aid::core::detail
+
+#endif//AID_INCLUDE_AID_CORE_RESULT_FAIL_HPP
@@ -0,0 +1,189 @@
+#ifndef AID_INCLUDE_AID_CORE_RESULT_VEC_HPP
+#define AID_INCLUDE_AID_CORE_RESULT_VEC_HPP
+
+#include <aid/core/result.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace aid::core
+{
+/**
+ * Structure-of-arrays batch of Results: one contiguous payload vector plus a separate
+ * validity bitmap.
+ *
+ * A vector of individual Result objects interleaves tags and payloads, so every loop
+ * over the batch branches per element and never vectorizes. Here the payload lanes
+ * stay contiguous (an element that failed keeps a default-constructed slot so the
+ * indices line up, which requires Ok to be default constructible), the validity bits
+ * live packed in 64-element words, and the errors are stored sparsely on the side.
+ * forEachOk() visits payloads word-at-a-time with a branch-free fast path for fully
+ * valid words, which is what lets the compiler auto-vectorize the payload loop.
+ *
+ * @tparam Ok success value type, default constructible
+ * @tparam Err error value type
+ */
+template<typename Ok, typename Err>
+class ResultVec
+{
+public:
+    /**
+     * Reserve storage for n elements.
+     * @param n expected batch size
+     */
+    void reserve(std::size_t n)
+    {
+        Values.reserve(n);
+        Bits.reserve((n + WordBits - 1) / WordBits);
+    }
+
+    /**
+     * Append a successful value.
+     * @param value payload being moved into the batch
+     */
+    void pushOk(Ok &&value)
+    {
+        setBit(Values.size(), true);
+        Values.push_back(std::move(value));
+    }
+
+    /**
+     * Append a failed element; its payload lane holds a default-constructed slot so
+     * the indices keep lining up with the bitmap.
+     * @param error error being moved into the batch
+     */
+    void pushErr(Err &&error)
+    {
+        setBit(Values.size(), false);
+        Errors.emplace_back(Values.size(), std::move(error));
+        Values.emplace_back();
+    }
+
+    /// Number of elements in the batch.
+    [[nodiscard]] auto size() const -> std::size_t { return Values.size(); }
+
+    /// Number of successful elements.
+    [[nodiscard]] auto okCount() const -> std::size_t { return Values.size() - Errors.size(); }
+
+    /// Number of failed elements.
+    [[nodiscard]] auto errCount() const -> std::size_t { return Errors.size(); }
+
+    /**
+     * Check the validity bit of one element.
+     * @param i element index
+     * @return True if element i holds a successful value.
+     */
+    [[nodiscard]] auto isOk(std::size_t i) const -> bool
+    {
+        return (Bits[i / WordBits] >> (i % WordBits) & 1u) != 0;
+    }
+
+    /// Contiguous payload lanes; slots of failed elements are default constructed.
+    [[nodiscard]] auto values() -> std::vector<Ok> & { return Values; }
+    [[nodiscard]] auto values() const -> const std::vector<Ok> & { return Values; }
+
+    /// Packed validity bitmap, 64 elements per word, bit i of word w is element w*64+i.
+    [[nodiscard]] auto validity() const -> const std::vector<std::uint64_t> & { return Bits; }
+
+    /// Sparse (index, error) pairs of the failed elements, in batch order.
+    [[nodiscard]] auto errors() const -> const std::vector<std::pair<std::size_t, Err>> &
+    {
+        return Errors;
+    }
+
+    /**
+     * Apply F to every valid payload.
+     *
+     * Fully valid bitmap words take a tight loop with no per-element branch, so a
+     * mostly-valid batch is processed at vector speed; mixed words fall back to a
+     * bit test per element.
+     * @param F function receiving Ok& for each valid element
+     */
+    template<typename Func>
+    void forEachOk(Func &&F)
+    {
+        auto n = Values.size();
+        for (std::size_t w = 0; w < Bits.size(); ++w) {
+            auto word = Bits[w];
+            auto base = w * WordBits;
+            auto limit = n - base < WordBits ? n - base : WordBits;
+            if (word == ~std::uint64_t{0} && limit == WordBits) {
+                for (std::size_t i = 0; i < WordBits; ++i) {
+                    F(Values[base + i]);
+                }
+            }
+            else {
+                for (std::size_t i = 0; i < limit; ++i) {
+                    if ((word >> i & 1u) != 0) {
+                        F(Values[base + i]);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Collapse the batch into a status: Ok when every element is valid, otherwise a
+     * copy of the first error in batch order.
+     * @return Status-only Result over the first error.
+     */
+    [[nodiscard]] auto allOk() const -> Result<void, Err>
+    {
+        if (Errors.empty()) {
+            return ok<void, Err>();
+        }
+        return err<void, Err>(Err{Errors.front().second});
+    }
+
+private:
+    static constexpr std::size_t WordBits = 64;
+
+    void setBit(std::size_t i, bool valid)
+    {
+        if (i % WordBits == 0) {
+            Bits.push_back(0);
+        }
+        if (valid) {
+            Bits[i / WordBits] |= std::uint64_t{1} << (i % WordBits);
+        }
+    }
+
+    std::vector<Ok> Values;
+    std::vector<std::uint64_t> Bits;
+    std::vector<std::pair<std::size_t, Err>> Errors;
+};
+
+/**
+ * Validate a contiguous batch into a ResultVec.
+ *
+ * Applies F to each of the n input records; the tag checks happen once here during
+ * the build, after which consumers loop over contiguous payloads and a packed bitmap
+ * instead of re-branching on every element.
+ * @tparam In input record type
+ * @tparam Func function mapping const In& to a Result
+ * @param first pointer to the first input record
+ * @param n number of records
+ * @param F validation function applied to each record
+ * @return ResultVec holding the per-element outcomes in input order.
+ */
+template<typename In, typename Func,
+         typename R = std::result_of_t<Func && (const In &)>,
+         typename Ok = typename R::OkType, typename Err = typename R::ErrType>
+auto map_n(const In *first, std::size_t n, Func &&F) -> ResultVec<Ok, Err>
+{
+    ResultVec<Ok, Err> out;
+    out.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        auto res = F(first[i]);
+        if (res.isOk()) {
+            out.pushOk(res.value());
+        }
+        else {
+            out.pushErr(res.err());
+        }
+    }
+    return out;
+}
+}// namespace aid::core
+
+#endif//AID_INCLUDE_AID_CORE_RESULT_VEC_HPP
@@ -0,0 +1,83 @@
+#ifndef AID_INCLUDE_AID_CORE_TRY_HPP
+#define AID_INCLUDE_AID_CORE_TRY_HPP
+
+#include <aid/core/result.hpp>
+#include <utility>
+
+namespace aid::core::detail
+{
+/**
+ * Carrier that converts a propagated error into the Result type of the enclosing
+ * function.
+ *
+ * The AID_TRY macros return an ErrPropagation from the failing branch; the implicit
+ * conversion operator rebuilds a Result with the caller's Ok type, so one macro works
+ * in any function whose Err type matches, including status-only Result<void, Err>
+ * returns.
+ *
+ * @tparam Err error value type being propagated
+ */
+template<typename Err>
+class ErrPropagation
+{
+public:
+    explicit ErrPropagation(Err &&value) : Value{std::move(value)} {}
+
+    template<typename Ok>
+    operator Result<Ok, Err>() &&// NOLINT: implicit by design, the macro relies on it
+    {
+        return ::aid::core::err<Ok, Err>(std::move(Value));
+    }
+
+private:
+    Err Value;
+};
+
+/**
+ * Wrap an error for propagation through the enclosing function's Result type.
+ * @tparam Err error value type
+ * @param value error being propagated
+ * @return Carrier converting to any Result<_, Err>.
+ */
+template<typename Err>
+auto propagateErr(Err &&value) -> ErrPropagation<Err>
+{
+    return ErrPropagation<Err>{std::move(value)};
+}
+}// namespace aid::core::detail
+
+#define AID_TRY_CONCAT_INNER(a, b) a##b
+#define AID_TRY_CONCAT(a, b) AID_TRY_CONCAT_INNER(a, b)
+
+/**
+ * Evaluate a Result expression and early-return its error from the enclosing function.
+ *
+ * Expands to a branch on isOk() plus a move — no lambda, no call overhead — so a deep
+ * fallible ladder compiles to the same code as hand-written if/return chains. The
+ * enclosing function must return a Result with the same Err type. A successful value,
+ * if any, is discarded; use AID_TRY_ASSIGN to keep it.
+ */
+#define AID_TRY(expr)                                                          \
+    do {                                                                       \
+        auto AID_TRY_CONCAT(aid_try_res_, __LINE__) = (expr);                  \
+        if (AID_TRY_CONCAT(aid_try_res_, __LINE__).isErr()) {                  \
+            return ::aid::core::detail::propagateErr(                          \
+                AID_TRY_CONCAT(aid_try_res_, __LINE__).err());                 \
+        }                                                                      \
+    } while (false)
+
+/**
+ * Evaluate a Result expression, early-return its error or bind its Ok value to var.
+ *
+ * Like AID_TRY, but declares `auto var` holding the moved-out Ok value in the
+ * enclosing scope on success.
+ */
+#define AID_TRY_ASSIGN(var, expr)                                              \
+    auto AID_TRY_CONCAT(aid_try_res_, __LINE__) = (expr);                      \
+    if (AID_TRY_CONCAT(aid_try_res_, __LINE__).isErr()) {                      \
+        return ::aid::core::detail::propagateErr(                              \
+            AID_TRY_CONCAT(aid_try_res_, __LINE__).err());                     \
+    }                                                                          \
+    auto var = AID_TRY_CONCAT(aid_try_res_, __LINE__).value()
+
+#endif//AID_INCLUDE_AID_CORE_TRY_HPP
@@ -0,0 +1,65 @@
+#ifndef AID_INCLUDE_AID_MPSC_ARENA_HPP
+#define AID_INCLUDE_AID_MPSC_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace aid::mpsc
+{
+/**
+ * Monotonic bump allocator over a caller-provided buffer.
+ *
+ * Channels placed into an arena via channel_in() carve their queue state (and, for
+ * bounded types, their element buffer) out of this buffer, so creating a channel
+ * costs a pointer bump instead of heap allocations. The arena never frees
+ * individually; the caller releases the whole buffer at once.
+ */
+class Arena
+{
+public:
+    /**
+     * Construct an arena over an existing buffer.
+     * @param buffer start of the backing storage
+     * @param size number of usable bytes in the buffer
+     */
+    Arena(void *buffer, std::size_t size)
+        : Cur{static_cast<std::byte *>(buffer)}, End{static_cast<std::byte *>(buffer) + size}
+    {}
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    /**
+     * Carve an aligned block out of the buffer.
+     * @param size number of bytes requested
+     * @param align required alignment of the block
+     * @return Pointer to the block or nullptr when the buffer is exhausted.
+     */
+    auto allocate(std::size_t size, std::size_t align) -> void *
+    {
+        auto address = reinterpret_cast<std::uintptr_t>(Cur);
+        auto aligned = (address + align - 1) & ~(static_cast<std::uintptr_t>(align) - 1);
+        auto *start = reinterpret_cast<std::byte *>(aligned);
+        if (start + size > End) {
+            return nullptr;
+        }
+        Cur = start + size;
+        return start;
+    }
+
+    /**
+     * Remaining capacity of the buffer.
+     * @return Number of bytes still available, ignoring alignment padding.
+     */
+    [[nodiscard]] auto remaining() const -> std::size_t
+    {
+        return static_cast<std::size_t>(End - Cur);
+    }
+
+private:
+    std::byte *Cur;
+    std::byte *End;
+};
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_ARENA_HPP
@@ -0,0 +1,233 @@
+#ifndef AID_INCLUDE_AID_MPSC_BOUNDED_MPSC_QUEUE_HPP
+#define AID_INCLUDE_AID_MPSC_BOUNDED_MPSC_QUEUE_HPP
+
+#include <aid/core/result.hpp>
+#include <aid/mpsc/cache_line.hpp>
+#include <aid/mpsc/channel_type.hpp>
+#include <aid/mpsc/hangup.hpp>
+#include <aid/mpsc/mpsc_error.hpp>
+#include <aid/mpsc/parker.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace aid::mpsc
+{
+/**
+ * Capacity-bounded queue for many producers and a single consumer.
+ *
+ * The capacity is a hard limit chosen at construction, so a stalled consumer can no
+ * longer grow the channel without bound. What happens to a push against a full queue
+ * is selected per channel through a FullQueuePolicy: park the producer until the
+ * consumer makes room, discard the oldest queued value, or reject the new one. The
+ * flat deque storage also keeps the backlog contiguous instead of a node chain.
+ *
+ * @tparam T element type stored in the queue
+ */
+template<typename T>
+class BoundedMpscQueue
+{
+public:
+    /**
+     * Construct a bounded queue.
+     * @param capacity maximum number of elements the queue may hold
+     * @param policy what a push against a full queue does; defaults to blocking
+     */
+    explicit BoundedMpscQueue(std::size_t capacity,
+                              FullQueuePolicy policy = FullQueuePolicy::Block)
+        : Capacity{capacity}, Policy{policy}
+    {}
+
+    /**
+     * Push a value into the queue, applying the configured full-queue policy.
+     *
+     * Block parks the calling producer until the consumer makes room (or the receiver
+     * is gone), DropOldest discards the oldest queued value to make room, and
+     * DropNewest leaves the argument untouched and reports the rejection.
+     * @param value data being moved into the queue
+     * @return Ok on success, MpscError::FullQueue when DropNewest rejects the value or
+     *         MpscError::Receiver when a blocked producer loses its receiver.
+     */
+    auto push(T &&value) -> core::Result<void, MpscError>
+    {
+        {
+            std::unique_lock lock(Mut);
+            if (!makeRoom(lock)) {
+                if (Policy == FullQueuePolicy::DropNewest) {
+                    return core::err<void, MpscError>(MpscError::FullQueue);
+                }
+                return core::err<void, MpscError>(MpscError::Receiver);
+            }
+            Q.push_back(std::move(value));
+        }
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Construct a value directly inside the queue, applying the full-queue policy.
+     * @param args constructor arguments forwarded to T
+     * @return Ok on success, MpscError::FullQueue when DropNewest rejects the value or
+     *         MpscError::Receiver when a blocked producer loses its receiver.
+     */
+    template<typename... Args>
+    auto emplace(Args &&...args) -> core::Result<void, MpscError>
+    {
+        {
+            std::unique_lock lock(Mut);
+            if (!makeRoom(lock)) {
+                if (Policy == FullQueuePolicy::DropNewest) {
+                    return core::err<void, MpscError>(MpscError::FullQueue);
+                }
+                return core::err<void, MpscError>(MpscError::Receiver);
+            }
+            Q.emplace_back(std::forward<Args>(args)...);
+        }
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Pop the oldest value out of the queue and wake one parked producer.
+     * @return Ok with the value or MpscError::EmptyQueue if no value is available.
+     */
+    auto pop() -> core::Result<T, MpscError>
+    {
+        std::scoped_lock lock(Mut);
+        if (Q.empty()) {
+            return core::err<T, MpscError>(MpscError::EmptyQueue);
+        }
+        auto owner = std::move(Q.front());
+        Q.pop_front();
+        SpaceCv.notify_one();
+        return core::ok<T, MpscError>(std::move(owner));
+    }
+
+    /**
+     * Push a range of values while taking the lock only once.
+     *
+     * DropOldest evicts queued values to fit the whole range; the other policies
+     * accept what fits and leave the rest untouched in the input range so the caller
+     * can retry the tail.
+     * @param first begin of the range being moved into the queue
+     * @param last end of the range
+     * @return Number of accepted elements.
+     */
+    template<typename It>
+    auto push_batch(It first, It last) -> core::Result<std::size_t, MpscError>
+    {
+        std::size_t n = 0;
+        {
+            std::scoped_lock lock(Mut);
+            for (; first != last; ++first, ++n) {
+                if (Q.size() == Capacity) {
+                    if (Policy != FullQueuePolicy::DropOldest) { break; }
+                    Q.pop_front();
+                }
+                Q.push_back(std::move(*first));
+            }
+        }
+        if (n > 0) { Park.notify(); }
+        return core::ok<std::size_t, MpscError>(std::move(n));
+    }
+
+    /**
+     * Pop up to max_n values while taking the lock only once.
+     * @param out output iterator receiving the popped values
+     * @param max_n maximum number of values to pop
+     * @return Number of popped elements, zero when the queue is empty.
+     */
+    template<typename OutIt>
+    auto pop_batch(OutIt out, std::size_t max_n) -> core::Result<std::size_t, MpscError>
+    {
+        std::scoped_lock lock(Mut);
+        std::size_t n = 0;
+        for (; n < max_n && !Q.empty(); ++n) {
+            *out++ = std::move(Q.front());
+            Q.pop_front();
+        }
+        if (n > 0) { SpaceCv.notify_all(); }
+        return core::ok<std::size_t, MpscError>(std::move(n));
+    }
+
+    /**
+     * Move the entire ready backlog out while taking the lock exactly once.
+     * @param out output iterator receiving the values
+     * @return Number of drained elements.
+     */
+    template<typename OutIt>
+    auto drain_all(OutIt out) -> std::size_t
+    {
+        std::scoped_lock lock(Mut);
+        std::size_t n = 0;
+        for (; !Q.empty(); ++n) {
+            *out++ = std::move(Q.front());
+            Q.pop_front();
+        }
+        if (n > 0) { SpaceCv.notify_all(); }
+        return n;
+    }
+
+    /**
+     * Number of elements the queue can hold.
+     * @return Capacity chosen at construction.
+     */
+    [[nodiscard]] auto capacity() const -> std::size_t { return Capacity; }
+
+    /**
+     * Parking spot used by a consumer that wants to block instead of spinning.
+     * @return Parker shared between the producers and the consumer of this queue.
+     */
+    auto parker() -> Parker & { return Park; }
+
+    /**
+     * Handle counts used by Sender and Receiver to detect a hangup.
+     * @return Hangup state shared by every handle of this channel.
+     */
+    auto hangup() -> detail::Hangup & { return Hang; }
+
+private:
+    /**
+     * Make room for one element under the configured policy; called with Mut held.
+     * @param lock the held queue lock, released while a Block producer parks
+     * @return True when a slot is free, false when the policy cannot provide one.
+     */
+    auto makeRoom(std::unique_lock<std::mutex> &lock) -> bool
+    {
+        if (Q.size() < Capacity) {
+            return true;
+        }
+        switch (Policy) {
+            case FullQueuePolicy::DropOldest:
+                Q.pop_front();
+                return true;
+            case FullQueuePolicy::DropNewest:
+                return false;
+            case FullQueuePolicy::Block:
+                break;
+        }
+        // park until the consumer pops; the periodic wake-up notices a receiver that
+        // dropped while this producer was blocked, so it cannot park forever
+        while (Q.size() == Capacity) {
+            if (Hang.receivers() == 0) {
+                return false;
+            }
+            SpaceCv.wait_for(lock, std::chrono::milliseconds(1),
+                             [this] { return Q.size() < Capacity; });
+        }
+        return true;
+    }
+
+    std::size_t Capacity;
+    FullQueuePolicy Policy;
+    alignas(CacheLineSize) std::deque<T> Q;
+    std::mutex Mut;
+    std::condition_variable SpaceCv;
+    alignas(CacheLineSize) Parker Park;
+    detail::Hangup Hang;
+};
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_BOUNDED_MPSC_QUEUE_HPP
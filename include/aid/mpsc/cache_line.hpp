@@ -0,0 +1,76 @@
+#ifndef AID_INCLUDE_AID_MPSC_CACHE_LINE_HPP
+#define AID_INCLUDE_AID_MPSC_CACHE_LINE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <thread>
+
+namespace aid::mpsc
+{
+/**
+ * Alignment used to keep producer- and consumer-touched channel state on separate
+ * cache lines.
+ *
+ * Defaults to the destructive interference size reported by the standard library
+ * (64 bytes when the toolchain does not provide one). Defining AID_MPSC_NO_CACHE_ALIGN
+ * drops the padding back to the natural alignment for memory-constrained builds where
+ * the extra bytes per channel matter more than the false-sharing cost.
+ */
+#if defined(AID_MPSC_NO_CACHE_ALIGN)
+inline constexpr std::size_t CacheLineSize = alignof(std::max_align_t);
+#elif defined(__cpp_lib_hardware_interference_size)
+inline constexpr std::size_t CacheLineSize = std::hardware_destructive_interference_size;
+#else
+inline constexpr std::size_t CacheLineSize = 64;
+#endif
+
+namespace detail
+{
+#ifndef NDEBUG
+/**
+ * Debug-build proxy counter for cache-line bounces.
+ *
+ * Every access records the calling thread; an access from a different thread than the
+ * previous one is counted as a bounce, since that is the pattern that forces the line
+ * to migrate between cores. The counter compiles away entirely in release builds.
+ */
+class SharingAudit
+{
+public:
+    /// Record an access to the guarded state from the calling thread.
+    void touch()
+    {
+        auto me = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        auto prev = Owner.exchange(me, std::memory_order_relaxed);
+        if (prev != 0 && prev != me) {
+            Bounces.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Number of owner-thread switches observed so far.
+     * @return Bounce count, always zero in release builds.
+     */
+    [[nodiscard]] auto bounces() const -> std::size_t
+    {
+        return Bounces.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::size_t> Owner{0};
+    std::atomic<std::size_t> Bounces{0};
+};
+#else
+class SharingAudit
+{
+public:
+    void touch() {}
+    [[nodiscard]] auto bounces() const -> std::size_t { return 0; }
+};
+#endif
+}// namespace detail
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_CACHE_LINE_HPP
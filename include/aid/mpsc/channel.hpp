@@ -1,21 +1,199 @@
 #ifndef AID_INCLUDE_AID_MPSC_CHANNEL_HPP
 #define AID_INCLUDE_AID_MPSC_CHANNEL_HPP
 
+#include <aid/core/result_fail.hpp>
+#include <aid/mpsc/arena.hpp>
+#include <aid/mpsc/backoff.hpp>
+#include <aid/mpsc/channel_traits.hpp>
 #include <aid/mpsc/channel_type.hpp>
+#include <aid/mpsc/receiver.hpp>
+#include <aid/mpsc/sender.hpp>
+#include <new>
+#include <memory>
 #include <utility>
+#include <type_traits>
 
-namespace aid::mpsc {
+namespace aid::mpsc
+{
 
-template<typename T, ChannelType CT>
-class Sender;
-template<typename T, ChannelType CT>
-class Receiver;
+namespace detail
+{
+template<typename Q, typename = void>
+struct HasReserve : std::false_type
+{
+};
 
-    template<typename T, ChannelType CT>
-    std::pair<Sender<T, CT>,Receiver<T,CT> channel() {
-        auto queue = std::make_shared<MpscQueue>();
-        return std::pair{Sender{queue}, Receiver{queue}};
+template<typename Q>
+struct HasReserve<Q, std::void_t<decltype(std::declval<Q &>().reserve(std::size_t{}))>> : std::true_type
+{
+};
+}// namespace detail
+
+/**
+ * Create a connected Sender/Receiver pair for an unbounded channel type.
+ * @tparam T element type carried by the channel
+ * @tparam CT channel type selecting the queue backend
+ * @return Pair of the sending and receiving half of the channel.
+ */
+template<typename T, ChannelType CT = ChannelType::OneShot, typename Backoff = AdaptiveBackoff>
+auto channel() -> std::pair<Sender<T, CT>, Receiver<T, CT, Backoff>>
+{
+    auto queue = std::make_shared<typename ChannelTraits<T, CT>::Queue>();
+    return std::pair{Sender<T, CT>{queue}, Receiver<T, CT, Backoff>{std::move(queue)}};
+}
+
+/**
+ * Create a connected Sender/Receiver pair for a bounded channel type.
+ * @tparam T element type carried by the channel
+ * @tparam CT channel type selecting the queue backend
+ * @param capacity minimum number of elements the channel can hold
+ * @return Pair of the sending and receiving half of the channel.
+ */
+template<typename T, ChannelType CT, typename Backoff = AdaptiveBackoff>
+auto channel(std::size_t capacity) -> std::pair<Sender<T, CT>, Receiver<T, CT, Backoff>>
+{
+    auto queue = std::make_shared<typename ChannelTraits<T, CT>::Queue>(capacity);
+    return std::pair{Sender<T, CT>{queue}, Receiver<T, CT, Backoff>{std::move(queue)}};
+}
+
+/**
+ * Create a connected bounded Sender/Receiver pair with an explicit full-queue policy.
+ * @tparam T element type carried by the channel
+ * @tparam CT channel type selecting the queue backend
+ * @param capacity maximum number of elements the channel may hold
+ * @param policy what a send against a full channel does
+ * @return Pair of the sending and receiving half of the channel.
+ */
+template<typename T, ChannelType CT, typename Backoff = AdaptiveBackoff>
+auto channel(std::size_t capacity, FullQueuePolicy policy)
+    -> std::pair<Sender<T, CT>, Receiver<T, CT, Backoff>>
+{
+    auto queue = std::make_shared<typename ChannelTraits<T, CT>::Queue>(capacity, policy);
+    return std::pair{Sender<T, CT>{queue}, Receiver<T, CT, Backoff>{std::move(queue)}};
+}
+
+/**
+ * Create a connected timestamp-ordered merging Sender/Receiver pair.
+ *
+ * Every producer thread sticks to one of the internal lanes; the receiver merges the
+ * lane heads by timestamp through the normal recv surface, so merging K per-core
+ * streams into one globally ordered stream needs no priority queue on the consumer
+ * side.
+ * @tparam T element type carried by the channel
+ * @param lanes number of per-producer lanes, typically one per producer thread
+ * @param ts timestamp extractor the merge is keyed by; must be monotone per producer
+ * @return Pair of the sending and receiving half of the channel.
+ */
+template<typename T, typename Backoff = AdaptiveBackoff>
+auto ordered_channel(std::size_t lanes, typename OrderedMergeQueue<T>::TimestampFn ts)
+    -> std::pair<Sender<T, ChannelType::OrderedMerge>,
+                 Receiver<T, ChannelType::OrderedMerge, Backoff>>
+{
+    auto queue = std::make_shared<OrderedMergeQueue<T>>(lanes, std::move(ts));
+    return std::pair{Sender<T, ChannelType::OrderedMerge>{queue},
+                     Receiver<T, ChannelType::OrderedMerge, Backoff>{std::move(queue)}};
+}
+
+/**
+ * Create a connected Sender/Receiver pair with storage for capacity elements reserved up front.
+ *
+ * Bounded backends receive the capacity through their constructor; node-based backends
+ * pre-fill their node cache so the first capacity sends perform no heap allocation.
+ * @tparam T element type carried by the channel
+ * @tparam CT channel type selecting the queue backend
+ * @param capacity number of elements to reserve storage for
+ * @return Pair of the sending and receiving half of the channel.
+ */
+template<typename T, ChannelType CT = ChannelType::OneShot, typename Backoff = AdaptiveBackoff>
+auto channel_with_capacity(std::size_t capacity) -> std::pair<Sender<T, CT>, Receiver<T, CT, Backoff>>
+{
+    using Queue = typename ChannelTraits<T, CT>::Queue;
+    std::shared_ptr<Queue> queue;
+    if constexpr (std::is_constructible_v<Queue, std::size_t>) {
+        queue = std::make_shared<Queue>(capacity);
+    }
+    else {
+        queue = std::make_shared<Queue>();
+    }
+    if constexpr (detail::HasReserve<Queue>::value) {
+        queue->reserve(capacity);
+    }
+    return std::pair{Sender<T, CT>{queue}, Receiver<T, CT, Backoff>{std::move(queue)}};
+}
+
+namespace detail
+{
+/**
+ * Wrap an arena-placed queue in a refcount-free handle.
+ *
+ * The aliasing constructor with an empty control block produces a shared_ptr that
+ * performs no reference counting and never deletes; the arena owner controls the
+ * lifetime. The queue's destructor is not run automatically, so arena channels
+ * should be drained (or carry trivially destructible payloads) before the arena
+ * storage is released.
+ */
+template<typename Queue>
+auto arenaHandle(Queue *queue) -> std::shared_ptr<Queue>
+{
+    return std::shared_ptr<Queue>{std::shared_ptr<void>{}, queue};
+}
+}// namespace detail
+
+/**
+ * Create a connected Sender/Receiver pair inside caller-provided arena storage.
+ *
+ * The queue state is placed into the arena and the handles are non-owning raw views,
+ * so creating the channel performs no heap allocation and no refcount traffic.
+ * @tparam T element type carried by the channel
+ * @tparam CT channel type selecting the queue backend
+ * @param arena arena the channel state is carved out of; must outlive the channel
+ * @return Pair of the sending and receiving half of the channel.
+ */
+template<typename T, ChannelType CT = ChannelType::OneShot, typename Backoff = AdaptiveBackoff>
+auto channel_in(Arena &arena) -> std::pair<Sender<T, CT>, Receiver<T, CT, Backoff>>
+{
+    using Queue = typename ChannelTraits<T, CT>::Queue;
+    auto *mem = arena.allocate(sizeof(Queue), alignof(Queue));
+    if (mem == nullptr) {
+        core::detail::resultFail("Trying to create a channel in an exhausted arena.");
+    }
+    auto *queue = new (mem) Queue{};
+    auto view = detail::arenaHandle(queue);
+    return std::pair{Sender<T, CT>{view}, Receiver<T, CT, Backoff>{std::move(view)}};
+}
+
+/**
+ * Create a connected bounded Sender/Receiver pair inside caller-provided arena storage.
+ *
+ * Queue state and element buffer are carved out of the same arena, so the channel
+ * occupies one contiguous region and its creation performs no heap allocation.
+ * @tparam T element type carried by the channel
+ * @tparam CT channel type selecting the queue backend
+ * @param arena arena the channel state is carved out of; must outlive the channel
+ * @param capacity minimum number of elements the channel can hold
+ * @return Pair of the sending and receiving half of the channel.
+ */
+template<typename T, ChannelType CT, typename Backoff = AdaptiveBackoff>
+auto channel_in(Arena &arena, std::size_t capacity) -> std::pair<Sender<T, CT>, Receiver<T, CT, Backoff>>
+{
+    using Queue = typename ChannelTraits<T, CT>::Queue;
+    auto *mem = arena.allocate(sizeof(Queue), alignof(Queue));
+    void *slots = nullptr;
+    if constexpr (std::is_constructible_v<Queue, std::size_t, void *>) {
+        slots = arena.allocate(Queue::requiredSlotBytes(capacity), alignof(T));
+    }
+    if (mem == nullptr || (std::is_constructible_v<Queue, std::size_t, void *> && slots == nullptr)) {
+        core::detail::resultFail("Trying to create a channel in an exhausted arena.");
+    }
+    std::shared_ptr<Queue> view;
+    if constexpr (std::is_constructible_v<Queue, std::size_t, void *>) {
+        view = detail::arenaHandle(new (mem) Queue{capacity, slots});
+    }
+    else {
+        view = detail::arenaHandle(new (mem) Queue{capacity});
     }
+    return std::pair{Sender<T, CT>{view}, Receiver<T, CT, Backoff>{std::move(view)}};
 }
+}// namespace aid::mpsc
 
 #endif//AID_INCLUDE_AID_MPSC_CHANNEL_HPP
@@ -0,0 +1,140 @@
+#ifndef AID_INCLUDE_AID_MPSC_CHANNEL_STATS_HPP
+#define AID_INCLUDE_AID_MPSC_CHANNEL_STATS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(AID_CHANNEL_STATS)
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#endif
+
+namespace aid::mpsc
+{
+/**
+ * Merged snapshot of one channel's operation counters.
+ *
+ * Populated by Queue::stats(); all fields are zero when the library is built without
+ * AID_CHANNEL_STATS.
+ */
+struct ChannelStats
+{
+    /// Values pushed into the channel.
+    std::size_t Enqueued{0};
+    /// Values popped out of the channel.
+    std::size_t Dequeued{0};
+    /// Pops that found the channel empty.
+    std::size_t EmptyPops{0};
+    /// Largest queue depth observed right after a push.
+    std::size_t MaxDepth{0};
+    /// Lock acquisitions that found the queue lock already held.
+    std::size_t LockContentions{0};
+};
+
+namespace detail
+{
+#if defined(AID_CHANNEL_STATS)
+/**
+ * Per-channel counter surface, sharded per thread.
+ *
+ * Every recording thread owns one shard per channel, found through a thread-local
+ * table, so the hot path is one relaxed increment on a line no other thread writes.
+ * snapshot() walks the registered shards and merges them; the counts are monotone, so
+ * a concurrent snapshot is a consistent lower bound rather than a torn read.
+ */
+class StatsRecorder
+{
+public:
+    StatsRecorder() : Id{NextId.fetch_add(1, std::memory_order_relaxed)} {}
+
+    StatsRecorder(const StatsRecorder &) = delete;
+    StatsRecorder &operator=(const StatsRecorder &) = delete;
+
+    void onEnqueue(std::size_t depth, std::size_t count = 1)
+    {
+        auto &s = shard();
+        s.Enqueued.fetch_add(count, std::memory_order_relaxed);
+        auto prev = s.MaxDepth.load(std::memory_order_relaxed);
+        while (prev < depth
+               && !s.MaxDepth.compare_exchange_weak(prev, depth, std::memory_order_relaxed)) {
+        }
+    }
+
+    void onDequeue(std::size_t count = 1)
+    {
+        shard().Dequeued.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void onEmptyPop() { shard().EmptyPops.fetch_add(1, std::memory_order_relaxed); }
+
+    void onContention() { shard().Contentions.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * Merge all thread shards into one snapshot.
+     * @return Accumulated counters of this channel.
+     */
+    [[nodiscard]] auto snapshot() const -> ChannelStats
+    {
+        ChannelStats out;
+        std::scoped_lock lock(Mut);
+        for (const auto &s : Shards) {
+            out.Enqueued += s->Enqueued.load(std::memory_order_relaxed);
+            out.Dequeued += s->Dequeued.load(std::memory_order_relaxed);
+            out.EmptyPops += s->EmptyPops.load(std::memory_order_relaxed);
+            out.LockContentions += s->Contentions.load(std::memory_order_relaxed);
+            auto depth = s->MaxDepth.load(std::memory_order_relaxed);
+            if (depth > out.MaxDepth) { out.MaxDepth = depth; }
+        }
+        return out;
+    }
+
+private:
+    struct Shard
+    {
+        std::atomic<std::size_t> Enqueued{0};
+        std::atomic<std::size_t> Dequeued{0};
+        std::atomic<std::size_t> EmptyPops{0};
+        std::atomic<std::size_t> MaxDepth{0};
+        std::atomic<std::size_t> Contentions{0};
+    };
+
+    /// Find (or register) the calling thread's shard for this channel.
+    auto shard() -> Shard &
+    {
+        // keyed by a process-unique channel id, so a recorder reusing the address of
+        // a destroyed one can never inherit a stale shard
+        thread_local std::unordered_map<std::uint64_t, std::shared_ptr<Shard>> local;
+        auto &slot = local[Id];
+        if (!slot) {
+            slot = std::make_shared<Shard>();
+            std::scoped_lock lock(Mut);
+            Shards.push_back(slot);
+        }
+        return *slot;
+    }
+
+    mutable std::mutex Mut;
+    std::vector<std::shared_ptr<Shard>> Shards;
+    std::uint64_t Id;
+
+    static inline std::atomic<std::uint64_t> NextId{1};
+};
+#else
+/// No-op recorder compiled in when AID_CHANNEL_STATS is off; every call folds away.
+class StatsRecorder
+{
+public:
+    void onEnqueue(std::size_t, std::size_t = 1) {}
+    void onDequeue(std::size_t = 1) {}
+    void onEmptyPop() {}
+    void onContention() {}
+    [[nodiscard]] auto snapshot() const -> ChannelStats { return {}; }
+};
+#endif
+}// namespace detail
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_CHANNEL_STATS_HPP
@@ -0,0 +1,68 @@
+#ifndef AID_INCLUDE_AID_MPSC_CHANNEL_TRAITS_HPP
+#define AID_INCLUDE_AID_MPSC_CHANNEL_TRAITS_HPP
+
+#include <aid/mpsc/bounded_mpsc_queue.hpp>
+#include <aid/mpsc/channel_type.hpp>
+#include <aid/mpsc/lock_free_mpsc_queue.hpp>
+#include <aid/mpsc/mpsc_queue.hpp>
+#include <aid/mpsc/one_shot_cell.hpp>
+#include <aid/mpsc/ordered_merge_queue.hpp>
+#include <aid/mpsc/spsc_ring_buffer.hpp>
+#include <aid/mpsc/work_stealing_queue.hpp>
+
+namespace aid::mpsc
+{
+/**
+ * Map a ChannelType onto the queue backend implementing it.
+ *
+ * Every backend exposes the same contract: push(T&&) returning
+ * Result<void, MpscError> that leaves the argument untouched on failure,
+ * and pop() returning Result<T, MpscError>.
+ *
+ * @tparam T element type carried by the channel
+ * @tparam CT channel type selecting the backend
+ */
+template<typename T, ChannelType CT>
+struct ChannelTraits
+{
+    using Queue = MpscQueue<T>;
+};
+
+template<typename T>
+struct ChannelTraits<T, ChannelType::OneShot>
+{
+    using Queue = OneShotCell<T>;
+};
+
+template<typename T>
+struct ChannelTraits<T, ChannelType::BoundedSpsc>
+{
+    using Queue = SpscRingBuffer<T>;
+};
+
+template<typename T>
+struct ChannelTraits<T, ChannelType::UnboundedLockFree>
+{
+    using Queue = LockFreeMpscQueue<T>;
+};
+
+template<typename T>
+struct ChannelTraits<T, ChannelType::MpmcWorkStealing>
+{
+    using Queue = WorkStealingQueue<T>;
+};
+
+template<typename T>
+struct ChannelTraits<T, ChannelType::BoundedMpsc>
+{
+    using Queue = BoundedMpscQueue<T>;
+};
+
+template<typename T>
+struct ChannelTraits<T, ChannelType::OrderedMerge>
+{
+    using Queue = OrderedMergeQueue<T>;
+};
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_CHANNEL_TRAITS_HPP
@@ -5,7 +5,30 @@ namespace aid::mpsc
 {
 enum ChannelType
 {
-    OneShot
+    OneShot,
+    /// Bounded single-producer single-consumer channel backed by a lock-free ring buffer.
+    BoundedSpsc,
+    /// Unbounded multi-producer single-consumer channel backed by a lock-free linked queue.
+    UnboundedLockFree,
+    /// Multi-producer multi-consumer channel with per-consumer deques and work stealing.
+    MpmcWorkStealing,
+    /// Capacity-bounded multi-producer single-consumer channel with a configurable
+    /// full-queue policy, backed by a flat deque.
+    BoundedMpsc,
+    /// Timestamp-ordered merging channel with per-producer lanes and a receiver-side
+    /// loser-tree merge keyed by a user-supplied timestamp extractor.
+    OrderedMerge
+};
+
+/// What a push against a full bounded channel does.
+enum class FullQueuePolicy
+{
+    /// Park the producer until the consumer makes room.
+    Block,
+    /// Discard the oldest queued value to make room for the new one.
+    DropOldest,
+    /// Reject the new value and hand it back to the producer.
+    DropNewest
 };
 }
 
@@ -0,0 +1,52 @@
+#ifndef AID_INCLUDE_AID_MPSC_HANGUP_HPP
+#define AID_INCLUDE_AID_MPSC_HANGUP_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace aid::mpsc::detail
+{
+/**
+ * Handle counts shared by every Sender and Receiver of one channel.
+ *
+ * The counts let both sides detect a hangup: a consumer whose producers are all gone
+ * stops waiting instead of spinning on an empty queue, and a producer whose consumer
+ * is gone fails fast instead of filling a queue nobody will drain. All accesses are
+ * seq_cst so a drop and the other side's count check cannot reorder past the final
+ * queue re-check.
+ */
+class Hangup
+{
+public:
+    void addSender() { Senders.fetch_add(1, std::memory_order_seq_cst); }
+
+    /**
+     * Drop one sender handle.
+     * @return True if this was the last sender, i.e. the channel is now disconnected.
+     */
+    auto dropSender() -> bool
+    {
+        return Senders.fetch_sub(1, std::memory_order_seq_cst) == 1;
+    }
+
+    [[nodiscard]] auto senders() const -> std::size_t
+    {
+        return Senders.load(std::memory_order_seq_cst);
+    }
+
+    void addReceiver() { Receivers.fetch_add(1, std::memory_order_seq_cst); }
+
+    void dropReceiver() { Receivers.fetch_sub(1, std::memory_order_seq_cst); }
+
+    [[nodiscard]] auto receivers() const -> std::size_t
+    {
+        return Receivers.load(std::memory_order_seq_cst);
+    }
+
+private:
+    std::atomic<std::size_t> Senders{0};
+    std::atomic<std::size_t> Receivers{0};
+};
+}// namespace aid::mpsc::detail
+
+#endif//AID_INCLUDE_AID_MPSC_HANGUP_HPP
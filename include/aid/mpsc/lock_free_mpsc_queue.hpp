@@ -0,0 +1,253 @@
+#ifndef AID_INCLUDE_AID_MPSC_LOCK_FREE_MPSC_QUEUE_HPP
+#define AID_INCLUDE_AID_MPSC_LOCK_FREE_MPSC_QUEUE_HPP
+
+#include <aid/core/result.hpp>
+#include <aid/mpsc/backoff.hpp>
+#include <aid/mpsc/cache_line.hpp>
+#include <aid/mpsc/hangup.hpp>
+#include <aid/mpsc/mpsc_error.hpp>
+#include <aid/mpsc/node_pool.hpp>
+#include <aid/mpsc/parker.hpp>
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace aid::mpsc
+{
+/**
+ * Unbounded lock-free queue for many producers and a single consumer.
+ *
+ * The layout follows Vyukov's MPSC linked queue: producers enqueue with one atomic
+ * exchange on the tail pointer followed by a release store that links the previous
+ * node, and the consumer dequeues with a single acquire load. A stub node keeps the
+ * list non-empty so neither side ever needs a compare-and-swap loop.
+ *
+ * A producer that has swapped the tail but not yet linked its node leaves the queue
+ * momentarily unobservable past that point; pop() reports EmptyQueue during that
+ * window and the consumer simply retries.
+ *
+ * @tparam T element type stored in the queue
+ */
+template<typename T>
+class LockFreeMpscQueue
+{
+public:
+    LockFreeMpscQueue()
+    {
+        auto *stub = newNode();
+        Head = stub;
+        Tail.store(stub, std::memory_order_relaxed);
+    }
+
+    LockFreeMpscQueue(const LockFreeMpscQueue &) = delete;
+    LockFreeMpscQueue &operator=(const LockFreeMpscQueue &) = delete;
+
+    ~LockFreeMpscQueue()
+    {
+        auto *node = Head;
+        while (node != nullptr) {
+            auto *next = node->Next.load(std::memory_order_relaxed);
+            deleteNode(node);
+            node = next;
+        }
+    }
+
+    /**
+     * Push a value into the queue.
+     *
+     * Safe to call from any number of producer threads concurrently.
+     * @param value data being moved into the queue
+     * @return Always Ok; the queue is unbounded.
+     */
+    auto push(T &&value) -> core::Result<void, MpscError>
+    {
+        auto *node = newNode();
+        node->Value.emplace(std::move(value));
+        auto *prev = Tail.exchange(node, std::memory_order_acq_rel);
+        prev->Next.store(node, std::memory_order_release);
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Construct a value directly inside a fresh node from the given arguments.
+     *
+     * Skips the stack-side construction and the move that push() needs.
+     * @param args constructor arguments forwarded to T
+     * @return Always Ok; the queue is unbounded.
+     */
+    template<typename... Args>
+    auto emplace(Args &&...args) -> core::Result<void, MpscError>
+    {
+        auto *node = newNode();
+        node->Value.emplace(std::forward<Args>(args)...);
+        auto *prev = Tail.exchange(node, std::memory_order_acq_rel);
+        prev->Next.store(node, std::memory_order_release);
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Pop the oldest linked value out of the queue.
+     *
+     * Must only be called from the single consumer thread.
+     * @return Ok with the value or MpscError::EmptyQueue if no linked node is visible.
+     */
+    auto pop() -> core::Result<T, MpscError>
+    {
+        auto *head = Head;
+        auto *next = head->Next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return core::err<T, MpscError>(MpscError::EmptyQueue);
+        }
+        auto owner = std::move(*next->Value);
+        // next becomes the new stub; the consumed head node is retired.
+        Head = next;
+        deleteNode(head);
+        return core::ok<T, MpscError>(std::move(owner));
+    }
+
+    /**
+     * Push a range of values with a single atomic exchange on the tail.
+     *
+     * The nodes are linked into a private chain first and the whole chain is then
+     * spliced behind the current tail, so producers contend once per batch instead
+     * of once per element.
+     * @param first begin of the range being moved into the queue
+     * @param last end of the range
+     * @return Number of accepted elements; the queue is unbounded so the whole range is taken.
+     */
+    template<typename It>
+    auto push_batch(It first, It last) -> core::Result<std::size_t, MpscError>
+    {
+        if (first == last) {
+            return core::ok<std::size_t, MpscError>(0u);
+        }
+        Node *chain_head = nullptr;
+        Node *chain_tail = nullptr;
+        std::size_t n = 0;
+        for (; first != last; ++first, ++n) {
+            auto *node = newNode();
+            node->Value.emplace(std::move(*first));
+            if (chain_head == nullptr) {
+                chain_head = node;
+            }
+            else {
+                chain_tail->Next.store(node, std::memory_order_relaxed);
+            }
+            chain_tail = node;
+        }
+        auto *prev = Tail.exchange(chain_tail, std::memory_order_acq_rel);
+        prev->Next.store(chain_head, std::memory_order_release);
+        Park.notify();
+        return core::ok<std::size_t, MpscError>(std::move(n));
+    }
+
+    /**
+     * Pop up to max_n linked values.
+     *
+     * Must only be called from the single consumer thread.
+     * @param out output iterator receiving the popped values
+     * @param max_n maximum number of values to pop
+     * @return Number of popped elements, zero when no linked node is visible.
+     */
+    template<typename OutIt>
+    auto pop_batch(OutIt out, std::size_t max_n) -> core::Result<std::size_t, MpscError>
+    {
+        std::size_t n = 0;
+        while (n < max_n) {
+            auto *next = Head->Next.load(std::memory_order_acquire);
+            if (next == nullptr) break;
+            *out++ = std::move(*next->Value);
+            auto *consumed = Head;
+            Head = next;
+            deleteNode(consumed);
+            ++n;
+        }
+        return core::ok<std::size_t, MpscError>(std::move(n));
+    }
+
+    /**
+     * Detach the entire ready backlog with a single atomic exchange on the tail.
+     *
+     * A fresh stub becomes the new empty queue; everything between the old head and
+     * the old tail then belongs exclusively to the consumer and is walked without any
+     * further synchronisation. A producer that swapped the tail before the detach but
+     * has not linked its node yet is waited out with a pause loop, exactly like the
+     * momentary unobservable window in pop().
+     * @param out output iterator receiving the values
+     * @return Number of drained elements.
+     */
+    template<typename OutIt>
+    auto drain_all(OutIt out) -> std::size_t
+    {
+        auto *stub = newNode();
+        auto *old_tail = Tail.exchange(stub, std::memory_order_acq_rel);
+        auto *node = Head;
+        std::size_t n = 0;
+        while (node != old_tail) {
+            auto *next = node->Next.load(std::memory_order_acquire);
+            while (next == nullptr) {
+                detail::cpuRelax();
+                next = node->Next.load(std::memory_order_acquire);
+            }
+            *out++ = std::move(*next->Value);
+            deleteNode(node);
+            node = next;
+            ++n;
+        }
+        // the fully consumed old tail is retired; the fresh stub heads the live queue
+        deleteNode(node);
+        Head = stub;
+        return n;
+    }
+
+    /**
+     * Parking spot used by a consumer that wants to block instead of spinning.
+     * @return Parker shared between the producers and the consumer of this queue.
+     */
+    auto parker() -> Parker & { return Park; }
+
+    /**
+     * Handle counts used by Sender and Receiver to detect a hangup.
+     * @return Hangup state shared by every handle of this channel.
+     */
+    auto hangup() -> detail::Hangup & { return Hang; }
+
+    /**
+     * Pre-fill the calling thread's node cache so the first n pushes allocate nothing.
+     * @param n number of nodes to reserve
+     */
+    void reserve(std::size_t n)
+    {
+        detail::NodePool<Node>::reserve(n);
+    }
+
+private:
+    struct Node
+    {
+        std::atomic<Node *> Next{nullptr};
+        std::optional<T> Value;
+    };
+
+    static auto newNode() -> Node *
+    {
+        return new (detail::NodePool<Node>::allocate()) Node{};
+    }
+
+    static void deleteNode(Node *node)
+    {
+        node->~Node();
+        detail::NodePool<Node>::deallocate(node);
+    }
+
+    // Head is consumer-only and Tail is hammered by every producer; separate lines
+    // keep a push's Tail exchange from invalidating the consumer's Head.
+    alignas(CacheLineSize) Node *Head;
+    alignas(CacheLineSize) std::atomic<Node *> Tail;
+    Parker Park;
+    detail::Hangup Hang;
+};
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_LOCK_FREE_MPSC_QUEUE_HPP
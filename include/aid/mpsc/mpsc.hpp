@@ -1,8 +1,12 @@
 #ifndef AID_INCLUDE_AID_MPSC_MPSC_HPP
 #define AID_INCLUDE_AID_MPSC_MPSC_HPP
 
+#include <aid/mpsc/channel.hpp>
 #include <aid/mpsc/channel_type.hpp>
 #include <aid/mpsc/mpsc_error.hpp>
+#include <aid/mpsc/receiver.hpp>
+#include <aid/mpsc/select.hpp>
+#include <aid/mpsc/topology.hpp>
 #include <aid/mpsc/sender.hpp>
 
 #endif//AID_INCLUDE_AID_MPSC_MPSC_HPP
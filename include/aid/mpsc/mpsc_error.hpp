@@ -1,22 +1,49 @@
 #ifndef AID_INCLUDE_AID_MPSC_MPSC_ERROR_HPP
 #define AID_INCLUDE_AID_MPSC_MPSC_ERROR_HPP
 
+#include <utility>
+
 namespace aid::mpsc
 {
+// Scoped so the Sender and Receiver enumerators do not collide with the class names.
+enum class MpscError {
+    Sender,
+    Receiver,
+    EmptyQueue,
+    FullQueue
+};
+
+/**
+ * Error returned by a failed send, carrying the undelivered value back to the caller.
+ *
+ * @tparam T element type carried by the channel
+ */
 template<typename T>
 class SenderError
 {
 public:
-    explicit SenderError(T &&value) : Value{std::move(value)} {}
+    explicit SenderError(T &&value, MpscError reason = MpscError::FullQueue)
+        : Value{std::move(value)}, Reason{reason}
+    {}
+
+    /**
+     * Why the send failed.
+     * @return MpscError::Receiver when the receiver is gone, MpscError::FullQueue otherwise.
+     */
+    [[nodiscard]] auto reason() const -> MpscError { return Reason; }
+
+    /**
+     * Move the undelivered value back out of the error.
+     *
+     * Rvalue-qualified so it can only consume an error the caller owns; the returned
+     * value can be retried or rerouted without a copy having been kept on the side.
+     * @return The value the failed send could not deliver.
+     */
+    [[nodiscard]] auto into_value() && -> T { return std::move(Value); }
 
 private:
     T Value;
-};
-
-enum MpscError {
-    Sender,
-    Receiver,
-    EmptyQueue
+    MpscError Reason;
 };
 
 }// namespace aid::mpsc
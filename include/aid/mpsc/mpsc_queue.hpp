@@ -2,7 +2,11 @@
 #define AID_INCLUDE_AID_MPSC_MPSC_QUEUE_HPP
 
 #include <aid/core/result.hpp>
+#include <aid/mpsc/cache_line.hpp>
+#include <aid/mpsc/channel_stats.hpp>
+#include <aid/mpsc/hangup.hpp>
 #include <aid/mpsc/mpsc_error.hpp>
+#include <aid/mpsc/parker.hpp>
 #include <mutex>
 #include <queue>
 namespace aid::mpsc
@@ -11,26 +15,168 @@ template<typename T>
 class MpscQueue
 {
 public:
-    void push(T &&value)
+    auto push(T &&value) -> core::Result<void, MpscError>
     {
-        std::scoped_lock lock(Mut);
-        Q.push(std::move(value));
+        {
+            auto lock = lockForStats();
+            Audit.touch();
+            Q.push(std::move(value));
+            Stats.onEnqueue(Q.size());
+        }
+        Park.notify();
+        return core::ok<void, MpscError>();
     }
-    auto pop() -> Result<T, MpscError>
+    /**
+     * Construct a value directly inside the queue from the given arguments.
+     *
+     * Skips the stack-side construction and the move that push() needs, which matters
+     * for message types that are expensive to move.
+     * @param args constructor arguments forwarded to T
+     * @return Always Ok; the queue is unbounded.
+     */
+    template<typename... Args>
+    auto emplace(Args &&...args) -> core::Result<void, MpscError>
     {
-        std::scoped_lock lock(Mut);
+        {
+            auto lock = lockForStats();
+            Audit.touch();
+            Q.emplace(std::forward<Args>(args)...);
+            Stats.onEnqueue(Q.size());
+        }
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    auto pop() -> core::Result<T, MpscError>
+    {
+        auto lock = lockForStats();
+        Audit.touch();
         if (!Q.empty()) {
             // move an existing value out of the queue while having the lock
             auto owner = std::move(Q.front());
             Q.pop();
+            Stats.onDequeue();
             return aid::core::ok<T, MpscError>(std::move(owner));
         }
+        Stats.onEmptyPop();
         return aid::core::err<T, MpscError>(MpscError::EmptyQueue);
     }
 
+    /**
+     * Push a range of values while taking the lock only once.
+     * @param first begin of the range being moved into the queue
+     * @param last end of the range
+     * @return Number of accepted elements; an unbounded queue accepts the whole range.
+     */
+    template<typename It>
+    auto push_batch(It first, It last) -> core::Result<std::size_t, MpscError>
+    {
+        std::size_t n = 0;
+        {
+            auto lock = lockForStats();
+            Audit.touch();
+            for (; first != last; ++first, ++n) {
+                Q.push(std::move(*first));
+            }
+            if (n > 0) { Stats.onEnqueue(Q.size(), n); }
+        }
+        if (n > 0) { Park.notify(); }
+        return core::ok<std::size_t, MpscError>(std::move(n));
+    }
+
+    /**
+     * Pop up to max_n values while taking the lock only once.
+     * @param out output iterator receiving the popped values
+     * @param max_n maximum number of values to pop
+     * @return Number of popped elements, zero when the queue is empty.
+     */
+    template<typename OutIt>
+    auto pop_batch(OutIt out, std::size_t max_n) -> core::Result<std::size_t, MpscError>
+    {
+        auto lock = lockForStats();
+        Audit.touch();
+        std::size_t n = 0;
+        for (; n < max_n && !Q.empty(); ++n) {
+            *out++ = std::move(Q.front());
+            Q.pop();
+        }
+        if (n > 0) { Stats.onDequeue(n); } else { Stats.onEmptyPop(); }
+        return core::ok<std::size_t, MpscError>(std::move(n));
+    }
+
+    /**
+     * Move the entire ready backlog out while taking the lock exactly once.
+     * @param out output iterator receiving the values
+     * @return Number of drained elements.
+     */
+    template<typename OutIt>
+    auto drain_all(OutIt out) -> std::size_t
+    {
+        auto lock = lockForStats();
+        Audit.touch();
+        std::size_t n = 0;
+        for (; !Q.empty(); ++n) {
+            *out++ = std::move(Q.front());
+            Q.pop();
+        }
+        if (n > 0) { Stats.onDequeue(n); }
+        return n;
+    }
+
+    /**
+     * Parking spot used by a consumer that wants to block instead of spinning.
+     * @return Parker shared between the producers and the consumer of this queue.
+     */
+    auto parker() -> Parker & { return Park; }
+
+    /**
+     * Handle counts used by Sender and Receiver to detect a hangup.
+     * @return Hangup state shared by every handle of this channel.
+     */
+    auto hangup() -> detail::Hangup & { return Hang; }
+
+    /**
+     * Number of owner-thread switches observed on the queue state (debug builds only).
+     * @return Cache-line bounce proxy count, always zero in release builds.
+     */
+    [[nodiscard]] auto auditBounces() const -> std::size_t { return Audit.bounces(); }
+
+    /**
+     * Merged per-channel operation counters.
+     * @return Snapshot of the counters; all zero without AID_CHANNEL_STATS.
+     */
+    [[nodiscard]] auto stats() const -> ChannelStats { return Stats.snapshot(); }
+
 private:
-    std::queue<T> Q;
+    /**
+     * Take the queue lock, recording a contention event when it is already held.
+     *
+     * Without AID_CHANNEL_STATS this is a plain blocking lock; the try_lock probe is
+     * only compiled in with the counters.
+     */
+    auto lockForStats() -> std::unique_lock<std::mutex>
+    {
+#if defined(AID_CHANNEL_STATS)
+        std::unique_lock lock(Mut, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            Stats.onContention();
+            lock.lock();
+        }
+        return lock;
+#else
+        return std::unique_lock{Mut};
+#endif
+    }
+
+    // The mutex-guarded queue state and the Parker (bumped by every push, polled by
+    // the consumer) each get their own cache line so a producer taking the lock does
+    // not drag the consumer's parking state along with it.
+    alignas(CacheLineSize) std::queue<T> Q;
     std::mutex Mut;
+    detail::SharingAudit Audit;
+    mutable detail::StatsRecorder Stats;
+    alignas(CacheLineSize) Parker Park;
+    detail::Hangup Hang;
 };
 }// namespace aid::mpsc
 
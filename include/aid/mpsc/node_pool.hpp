@@ -0,0 +1,88 @@
+#ifndef AID_INCLUDE_AID_MPSC_NODE_POOL_HPP
+#define AID_INCLUDE_AID_MPSC_NODE_POOL_HPP
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace aid::mpsc::detail
+{
+/**
+ * Freelist pool for the fixed-size nodes of the linked queue backends.
+ *
+ * Spent node memory is cached in a thread-local shard instead of going back to the
+ * heap, so a steady-state producer/consumer pair recycles node storage without any
+ * malloc/free traffic. Each shard is capped: nodes freed beyond the cap (e.g. a
+ * consumer retiring nodes allocated by many producers) fall back to operator delete.
+ *
+ * @tparam Node node type whose raw storage is pooled
+ */
+template<typename Node>
+class NodePool
+{
+public:
+    /**
+     * Take raw node storage from the calling thread's shard, or the heap if the shard is empty.
+     * @return Uninitialised storage for one Node.
+     */
+    static auto allocate() -> void *
+    {
+        auto &shard = localShard();
+        if (!shard.Free.empty()) {
+            auto *p = shard.Free.back();
+            shard.Free.pop_back();
+            return p;
+        }
+        return ::operator new(sizeof(Node));
+    }
+
+    /**
+     * Return raw node storage to the calling thread's shard.
+     * @param p storage previously obtained from allocate()
+     */
+    static void deallocate(void *p)
+    {
+        auto &shard = localShard();
+        if (shard.Free.size() < MaxCached) {
+            shard.Free.push_back(p);
+            return;
+        }
+        ::operator delete(p);
+    }
+
+    /**
+     * Pre-fill the calling thread's shard so the first n allocations hit the cache.
+     * @param n number of nodes to reserve
+     */
+    static void reserve(std::size_t n)
+    {
+        auto &shard = localShard();
+        if (n > MaxCached) { n = MaxCached; }
+        while (shard.Free.size() < n) {
+            shard.Free.push_back(::operator new(sizeof(Node)));
+        }
+    }
+
+private:
+    struct Shard
+    {
+        std::vector<void *> Free;
+
+        ~Shard()
+        {
+            for (auto *p : Free) { ::operator delete(p); }
+        }
+    };
+
+    static auto localShard() -> Shard &
+    {
+        thread_local Shard S;
+        return S;
+    }
+
+    /// Upper bound per shard so a consumer draining many producers cannot hoard memory.
+    static constexpr std::size_t MaxCached = 1024;
+};
+}// namespace aid::mpsc::detail
+
+#endif//AID_INCLUDE_AID_MPSC_NODE_POOL_HPP
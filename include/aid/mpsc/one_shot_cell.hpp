@@ -0,0 +1,146 @@
+#ifndef AID_INCLUDE_AID_MPSC_ONE_SHOT_CELL_HPP
+#define AID_INCLUDE_AID_MPSC_ONE_SHOT_CELL_HPP
+
+#include <aid/core/result.hpp>
+#include <aid/mpsc/hangup.hpp>
+#include <aid/mpsc/mpsc_error.hpp>
+#include <aid/mpsc/parker.hpp>
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace aid::mpsc
+{
+/**
+ * Single-slot backend for one-shot channels.
+ *
+ * A one-shot channel carries exactly one value, so the whole queue is one aligned
+ * storage slot plus one atomic state word: send is a claim, an in-place construction
+ * and a release store; recv is an acquire load and a move out of the slot. No mutex,
+ * no node allocation and no deque, which matters when channels are created per RPC
+ * completion.
+ *
+ * @tparam T element type carried by the cell
+ */
+template<typename T>
+class OneShotCell
+{
+public:
+    OneShotCell() = default;
+    OneShotCell(const OneShotCell &) = delete;
+    OneShotCell &operator=(const OneShotCell &) = delete;
+
+    ~OneShotCell()
+    {
+        if (Stat.load(std::memory_order_acquire) == State::Ready) {
+            slot()->~T();
+        }
+    }
+
+    /**
+     * Store the one value of the cell.
+     *
+     * The claim is a compare-and-swap so a second sender (or a double send) fails
+     * cleanly instead of overwriting; the value itself is published by a single
+     * release store. On failure the argument is left untouched.
+     * @param value data being moved into the cell
+     * @return Ok on success or MpscError::FullQueue if the cell was already used.
+     */
+    auto push(T &&value) -> core::Result<void, MpscError>
+    {
+        auto expected = State::Empty;
+        if (!Stat.compare_exchange_strong(expected, State::Writing, std::memory_order_acquire)) {
+            return core::err<void, MpscError>(MpscError::FullQueue);
+        }
+        new (slot()) T(std::move(value));
+        Stat.store(State::Ready, std::memory_order_release);
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Construct the one value of the cell directly in its slot from the given arguments.
+     *
+     * Skips the stack-side construction and the move that push() needs.
+     * @param args constructor arguments forwarded to T
+     * @return Ok on success or MpscError::FullQueue if the cell was already used.
+     */
+    template<typename... Args>
+    auto emplace(Args &&...args) -> core::Result<void, MpscError>
+    {
+        auto expected = State::Empty;
+        if (!Stat.compare_exchange_strong(expected, State::Writing, std::memory_order_acquire)) {
+            return core::err<void, MpscError>(MpscError::FullQueue);
+        }
+        new (slot()) T(std::forward<Args>(args)...);
+        Stat.store(State::Ready, std::memory_order_release);
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Take the one value out of the cell.
+     * @return Ok with the value or MpscError::EmptyQueue if no value is ready.
+     */
+    auto pop() -> core::Result<T, MpscError>
+    {
+        if (Stat.load(std::memory_order_acquire) != State::Ready) {
+            return core::err<T, MpscError>(MpscError::EmptyQueue);
+        }
+        auto *p = slot();
+        auto owner = std::move(*p);
+        p->~T();
+        Stat.store(State::Taken, std::memory_order_release);
+        return core::ok<T, MpscError>(std::move(owner));
+    }
+
+    /**
+     * Move the one value out of the cell, if it is ready.
+     * @param out output iterator receiving the value
+     * @return One if a value was drained, zero otherwise.
+     */
+    template<typename OutIt>
+    auto drain_all(OutIt out) -> std::size_t
+    {
+        auto res = pop();
+        if (res.isOk()) {
+            *out++ = res.value();
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * Parking spot used by a consumer that wants to block instead of spinning.
+     * @return Parker shared between the sender and the consumer of this cell.
+     */
+    auto parker() -> Parker & { return Park; }
+
+    /**
+     * Handle counts used by Sender and Receiver to detect a hangup.
+     * @return Hangup state shared by every handle of this channel.
+     */
+    auto hangup() -> detail::Hangup & { return Hang; }
+
+private:
+    enum class State : unsigned char
+    {
+        Empty,
+        Writing,
+        Ready,
+        Taken
+    };
+
+    auto slot() -> T *
+    {
+        return reinterpret_cast<T *>(&Storage);
+    }
+
+    std::aligned_storage_t<sizeof(T), alignof(T)> Storage;
+    std::atomic<State> Stat{State::Empty};
+    Parker Park;
+    detail::Hangup Hang;
+};
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_ONE_SHOT_CELL_HPP
@@ -0,0 +1,297 @@
+#ifndef AID_INCLUDE_AID_MPSC_ORDERED_MERGE_QUEUE_HPP
+#define AID_INCLUDE_AID_MPSC_ORDERED_MERGE_QUEUE_HPP
+
+#include <aid/core/result.hpp>
+#include <aid/mpsc/cache_line.hpp>
+#include <aid/mpsc/hangup.hpp>
+#include <aid/mpsc/mpsc_error.hpp>
+#include <aid/mpsc/parker.hpp>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace aid::mpsc
+{
+/**
+ * Timestamp-ordered merging queue for many producers and a single consumer.
+ *
+ * Every producer thread sticks to one of K internal lanes, so each lane receives a
+ * naturally timestamp-ordered sub-stream and never needs per-element reordering. The
+ * consumer merges the lane heads through a loser tree keyed by a user-supplied
+ * timestamp extractor: popping the globally oldest element costs one comparison per
+ * tree level (log2 K) instead of the O(log n) heap churn of re-heapifying a
+ * priority_queue on every element.
+ *
+ * pop() returns the oldest element currently queued; an element still in flight on
+ * an idle lane is merged in as soon as it arrives, which matches the guarantee of
+ * draining into a priority queue. The extractor must be monotone per producer and
+ * never return the maximum std::uint64_t, which is reserved as the empty-lane
+ * sentinel.
+ *
+ * @tparam T element type stored in the queue
+ */
+template<typename T>
+class OrderedMergeQueue
+{
+public:
+    /// Function mapping an element to its merge timestamp.
+    using TimestampFn = std::function<std::uint64_t(const T &)>;
+
+    /**
+     * Construct a merging queue.
+     * @param lanes number of per-producer lanes, typically one per producer thread
+     * @param ts timestamp extractor the merge is keyed by
+     */
+    OrderedMergeQueue(std::size_t lanes, TimestampFn ts)
+        : Ts{std::move(ts)}, Id{NextId.fetch_add(1, std::memory_order_relaxed)}
+    {
+        auto n = lanes > 0 ? lanes : 1;
+        LeafCount = 1;
+        while (LeafCount < n) {
+            LeafCount *= 2;
+        }
+        Lanes = std::vector<Lane>(n);
+        Keys.assign(LeafCount, Inf);
+        Tree.assign(LeafCount, 0);
+        rebuild();
+    }
+
+    /**
+     * Push a value into the calling thread's lane.
+     * @param value data being moved into the queue
+     * @return Ok, the queue is unbounded.
+     */
+    auto push(T &&value) -> core::Result<void, MpscError>
+    {
+        auto &lane = Lanes[myLane()];
+        {
+            std::scoped_lock lock(lane.Mut);
+            lane.Q.push_back(std::move(value));
+        }
+        lane.Size.fetch_add(1, std::memory_order_release);
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Construct a value directly inside the calling thread's lane.
+     * @param args constructor arguments forwarded to T
+     * @return Ok, the queue is unbounded.
+     */
+    template<typename... Args>
+    auto emplace(Args &&...args) -> core::Result<void, MpscError>
+    {
+        auto &lane = Lanes[myLane()];
+        {
+            std::scoped_lock lock(lane.Mut);
+            lane.Q.emplace_back(std::forward<Args>(args)...);
+        }
+        lane.Size.fetch_add(1, std::memory_order_release);
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Pop the queued element with the smallest timestamp.
+     * @return Ok with the value or MpscError::EmptyQueue if no value is available.
+     */
+    auto pop() -> core::Result<T, MpscError>
+    {
+        refreshEmptyLanes();
+        auto w = Winner;
+        if (Keys[w] == Inf) {
+            return core::err<T, MpscError>(MpscError::EmptyQueue);
+        }
+        auto &lane = Lanes[w];
+        std::optional<T> owner;
+        {
+            std::scoped_lock lock(lane.Mut);
+            owner.emplace(std::move(lane.Q.front()));
+            lane.Q.pop_front();
+            Keys[w] = lane.Q.empty() ? Inf : Ts(lane.Q.front());
+        }
+        lane.Size.fetch_sub(1, std::memory_order_release);
+        replay(w);
+        return core::ok<T, MpscError>(std::move(*owner));
+    }
+
+    /**
+     * Push a range of values into the calling thread's lane with one lock.
+     * @param first begin of the range being moved into the queue
+     * @param last end of the range
+     * @return Number of pushed elements.
+     */
+    template<typename It>
+    auto push_batch(It first, It last) -> core::Result<std::size_t, MpscError>
+    {
+        auto &lane = Lanes[myLane()];
+        std::size_t n = 0;
+        {
+            std::scoped_lock lock(lane.Mut);
+            for (; first != last; ++first, ++n) {
+                lane.Q.push_back(std::move(*first));
+            }
+        }
+        if (n > 0) {
+            lane.Size.fetch_add(n, std::memory_order_release);
+            Park.notify();
+        }
+        return core::ok<std::size_t, MpscError>(std::move(n));
+    }
+
+    /**
+     * Pop up to max_n elements in global timestamp order.
+     * @param out output iterator receiving the popped values
+     * @param max_n maximum number of values to pop
+     * @return Number of popped elements, zero when the queue is empty.
+     */
+    template<typename OutIt>
+    auto pop_batch(OutIt out, std::size_t max_n) -> core::Result<std::size_t, MpscError>
+    {
+        std::size_t n = 0;
+        for (; n < max_n; ++n) {
+            auto res = pop();
+            if (res.isErr()) {
+                break;
+            }
+            *out++ = res.value();
+        }
+        return core::ok<std::size_t, MpscError>(std::move(n));
+    }
+
+    /**
+     * Move every queued element out in global timestamp order.
+     * @param out output iterator receiving the values
+     * @return Number of drained elements.
+     */
+    template<typename OutIt>
+    auto drain_all(OutIt out) -> std::size_t
+    {
+        std::size_t n = 0;
+        for (;; ++n) {
+            auto res = pop();
+            if (res.isErr()) {
+                break;
+            }
+            *out++ = res.value();
+        }
+        return n;
+    }
+
+    /// Number of per-producer lanes.
+    [[nodiscard]] auto lanes() const -> std::size_t { return Lanes.size(); }
+
+    /**
+     * Parking spot used by a consumer that wants to block instead of spinning.
+     * @return Parker shared between the producers and the consumer of this queue.
+     */
+    auto parker() -> Parker & { return Park; }
+
+    /**
+     * Handle counts used by Sender and Receiver to detect a hangup.
+     * @return Hangup state shared by every handle of this channel.
+     */
+    auto hangup() -> detail::Hangup & { return Hang; }
+
+private:
+    static constexpr std::uint64_t Inf = std::numeric_limits<std::uint64_t>::max();
+
+    struct Lane
+    {
+        alignas(CacheLineSize) std::mutex Mut;
+        std::deque<T> Q;
+        std::atomic<std::size_t> Size{0};
+    };
+
+    /// Lane the calling thread is pinned to, assigned round-robin on first use.
+    auto myLane() -> std::size_t
+    {
+        // keyed by a process-unique queue id, so a queue reusing the address of a
+        // destroyed one can never inherit a stale assignment
+        thread_local std::unordered_map<std::uint64_t, std::size_t> local;
+        auto it = local.find(Id);
+        if (it == local.end()) {
+            auto lane = NextLane.fetch_add(1, std::memory_order_relaxed) % Lanes.size();
+            it = local.emplace(Id, lane).first;
+        }
+        return it->second;
+    }
+
+    /// Pull lanes that were cached empty but have since been pushed into the tree.
+    void refreshEmptyLanes()
+    {
+        // a replay is only valid for the previous winner's leaf, so an arbitrary
+        // lane coming back from empty rebuilds the tree; the transition is rare on
+        // a steady stream and the pop path keeps its log K replay
+        bool refreshed = false;
+        for (std::size_t i = 0; i < Lanes.size(); ++i) {
+            if (Keys[i] == Inf && Lanes[i].Size.load(std::memory_order_acquire) > 0) {
+                std::scoped_lock lock(Lanes[i].Mut);
+                Keys[i] = Ts(Lanes[i].Q.front());
+                refreshed = true;
+            }
+        }
+        if (refreshed) {
+            rebuild();
+        }
+    }
+
+    /// Rebuild the full loser tree from the cached lane keys.
+    void rebuild()
+    {
+        std::vector<std::size_t> winner(2 * LeafCount);
+        for (std::size_t i = 0; i < LeafCount; ++i) {
+            winner[LeafCount + i] = i;
+        }
+        for (auto node = LeafCount - 1; node >= 1; --node) {
+            auto a = winner[2 * node];
+            auto b = winner[2 * node + 1];
+            auto left = beats(a, b);
+            winner[node] = left ? a : b;
+            Tree[node] = left ? b : a;
+        }
+        Winner = winner[1];
+    }
+
+    /// Replay the tournament path of one leaf after its key changed.
+    void replay(std::size_t leaf)
+    {
+        auto cur = leaf;
+        for (auto node = (leaf + LeafCount) / 2; node >= 1; node /= 2) {
+            if (beats(Tree[node], cur)) {
+                std::swap(cur, Tree[node]);
+            }
+        }
+        Winner = cur;
+    }
+
+    /// Tournament order: smaller timestamp wins, ties break on the lower lane.
+    [[nodiscard]] auto beats(std::size_t a, std::size_t b) const -> bool
+    {
+        return Keys[a] < Keys[b] || (Keys[a] == Keys[b] && a < b);
+    }
+
+    TimestampFn Ts;
+    std::vector<Lane> Lanes;
+    /// Consumer-private merge state: cached head timestamps and the loser tree.
+    std::size_t LeafCount{1};
+    std::vector<std::uint64_t> Keys;
+    std::vector<std::size_t> Tree;
+    std::size_t Winner{0};
+    std::uint64_t Id;
+    std::atomic<std::size_t> NextLane{0};
+    alignas(CacheLineSize) Parker Park;
+    detail::Hangup Hang;
+
+    static inline std::atomic<std::uint64_t> NextId{1};
+};
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_ORDERED_MERGE_QUEUE_HPP
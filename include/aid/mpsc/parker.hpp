@@ -0,0 +1,119 @@
+#ifndef AID_INCLUDE_AID_MPSC_PARKER_HPP
+#define AID_INCLUDE_AID_MPSC_PARKER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace aid::mpsc
+{
+/**
+ * Eventcount-style parking spot shared by the producers and the consumer of a channel.
+ *
+ * The consumer reads the epoch, re-checks the queue and only then parks; a producer
+ * bumps the epoch on every push and only touches the mutex/condition variable when a
+ * waiter is registered, so the uncontended push fast path stays one relaxed-ish atomic.
+ * All four flag/epoch accesses are seq_cst so the "empty check vs. waiter check" race
+ * between both sides resolves to either a visible element or a visible waiter.
+ */
+class Parker
+{
+public:
+    /**
+     * Read the current wake epoch. Pass the value to wait() to detect wake-ups that
+     * happen between the queue re-check and the actual park.
+     * @return Current epoch value.
+     */
+    [[nodiscard]] auto epoch() const -> unsigned
+    {
+        return Seq.load(std::memory_order_seq_cst);
+    }
+
+    /**
+     * Wake the parked consumer, if any.
+     */
+    void notify()
+    {
+        Seq.fetch_add(1, std::memory_order_seq_cst);
+        if (Waiting.load(std::memory_order_seq_cst)) {
+            std::scoped_lock lock(Mut);
+            Cv.notify_all();
+        }
+        if (HasListener.load(std::memory_order_seq_cst)) {
+            // copy the listener out so it runs outside the mutex: a listener that
+            // resumes a coroutine may re-enter clearListener() on this Parker
+            std::function<void()> listener;
+            {
+                std::scoped_lock lock(Mut);
+                listener = ListenerFn;
+            }
+            if (listener) { listener(); }
+        }
+    }
+
+    /**
+     * Attach a readiness listener that is invoked on every notify.
+     *
+     * Used by the select engine to flip a shared event word; the fast path of
+     * notify() only pays one extra atomic load while no listener is attached.
+     * @param listener callback invoked after each notify
+     */
+    void setListener(std::function<void()> listener)
+    {
+        std::scoped_lock lock(Mut);
+        ListenerFn = std::move(listener);
+        HasListener.store(true, std::memory_order_seq_cst);
+    }
+
+    /**
+     * Detach the readiness listener.
+     */
+    void clearListener()
+    {
+        std::scoped_lock lock(Mut);
+        ListenerFn = nullptr;
+        HasListener.store(false, std::memory_order_seq_cst);
+    }
+
+    /**
+     * Park until the epoch moves past the given value.
+     * @param e epoch observed before the caller last checked the queue
+     */
+    void wait(unsigned e)
+    {
+        std::unique_lock lock(Mut);
+        Waiting.store(true, std::memory_order_seq_cst);
+        Cv.wait(lock, [&] { return Seq.load(std::memory_order_seq_cst) != e; });
+        Waiting.store(false, std::memory_order_seq_cst);
+    }
+
+    /**
+     * Park until the epoch moves past the given value or the timeout expires.
+     * @param e epoch observed before the caller last checked the queue
+     * @param timeout maximum time to stay parked
+     * @return True if woken by a notify, false on timeout.
+     */
+    template<typename Rep, typename Period>
+    auto waitFor(unsigned e, const std::chrono::duration<Rep, Period> &timeout) -> bool
+    {
+        std::unique_lock lock(Mut);
+        Waiting.store(true, std::memory_order_seq_cst);
+        auto woken = Cv.wait_for(lock, timeout, [&] { return Seq.load(std::memory_order_seq_cst) != e; });
+        Waiting.store(false, std::memory_order_seq_cst);
+        return woken;
+    }
+
+private:
+    std::atomic<unsigned> Seq{0};
+    std::atomic<bool> Waiting{false};
+    std::atomic<bool> HasListener{false};
+    std::mutex Mut;
+    std::condition_variable Cv;
+    std::function<void()> ListenerFn;
+};
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_PARKER_HPP
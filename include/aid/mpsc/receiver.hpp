@@ -2,19 +2,471 @@
 #define AID_INCLUDE_AID_MPSC_RECEIVER_HPP
 
 #include <aid/core/result.hpp>
+#include <aid/mpsc/backoff.hpp>
+#include <aid/mpsc/channel_traits.hpp>
 #include <aid/mpsc/channel_type.hpp>
+#include <aid/mpsc/mpsc_error.hpp>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define AID_HAS_COROUTINES 1
+#include <atomic>
+#include <coroutine>
+#endif
 
 namespace aid::mpsc
 {
-template<typename T, ChannelType CT>
+#if defined(AID_HAS_COROUTINES)
+template<typename T, ChannelType CT, typename Backoff>
+class RecvAwaiter;
+#endif
+
+/**
+ * Receiving half of a channel.
+ *
+ * A Receiver moves values out of the queue backend selected by the channel type.
+ * Instances are created by the channel() factory in channel.hpp.
+ *
+ * @tparam T element type carried by the channel
+ * @tparam CT channel type selecting the queue backend
+ * @tparam Backoff policy shaping the retry phase of the blocking receives
+ */
+template<typename T, ChannelType CT = ChannelType::OneShot, typename Backoff = AdaptiveBackoff>
 class Receiver
 {
-    template<typename T, ChannelType CT = ChannelType::OneShot>
-    auto recv(T &&t) -> Result<std::void_t, RecvError<T>>
+public:
+    using Queue = typename ChannelTraits<T, CT>::Queue;
+
+    explicit Receiver(std::shared_ptr<Queue> queue) : Q{std::move(queue)}
+    {
+        Q->hangup().addReceiver();
+    }
+
+    Receiver(const Receiver &) = delete;
+    Receiver &operator=(const Receiver &) = delete;
+
+    Receiver(Receiver &&other) noexcept : Q{std::move(other.Q)} {}
+
+    Receiver &operator=(Receiver &&other) noexcept
+    {
+        if (this != &other) {
+            if (Q) { Q->hangup().dropReceiver(); }
+            Q = std::move(other.Q);
+        }
+        return *this;
+    }
+
+    ~Receiver()
+    {
+        if (Q) { Q->hangup().dropReceiver(); }
+    }
+
+    /**
+     * Move the oldest value out of the channel.
+     * @return Ok with the value, MpscError::EmptyQueue if no value is available yet, or
+     *         MpscError::Sender if the channel is empty and every sender is gone.
+     */
+    auto recv() -> core::Result<T, MpscError>
+    {
+        auto res = Q->pop();
+        if (res.isOk() || !disconnected()) {
+            return res;
+        }
+        // the last sender may have pushed right before dropping; re-check once after
+        // observing the count so that value is not reported as a hangup
+        auto retry = Q->pop();
+        if (retry.isOk()) {
+            return retry;
+        }
+        return core::err<T, MpscError>(MpscError::Sender);
+    }
+
+    /**
+     * Move the oldest value out of the channel, parking the thread while the channel is empty.
+     *
+     * The Backoff policy shapes the retry phase and keeps the wake-up latency low
+     * under load; only after its budget is exhausted does the consumer arm the
+     * channel's Parker and block, so an idle consumer costs no CPU.
+     * @return Ok with the received value.
+     */
+    auto recv_blocking() -> core::Result<T, MpscError>
+    {
+        Backoff backoff;
+        do {
+            auto res = Q->pop();
+            if (res.isOk()) { return res; }
+        } while (backoff.snooze());
+        while (true) {
+            auto e = Q->parker().epoch();
+            auto res = Q->pop();
+            if (res.isOk()) { return res; }
+            if (disconnected()) {
+                auto retry = Q->pop();
+                if (retry.isOk()) { return retry; }
+                return core::err<T, MpscError>(MpscError::Sender);
+            }
+            Q->parker().wait(e);
+        }
+    }
+
+    /**
+     * Move the oldest value out of the channel, parking the thread at most for the given duration.
+     * @param timeout maximum time to wait for a value
+     * @return Ok with the received value or MpscError::EmptyQueue when the timeout expires.
+     */
+    template<typename Rep, typename Period>
+    auto recv_timeout(const std::chrono::duration<Rep, Period> &timeout) -> core::Result<T, MpscError>
+    {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        Backoff backoff;
+        do {
+            auto res = Q->pop();
+            if (res.isOk()) { return res; }
+        } while (backoff.snooze());
+        while (true) {
+            auto e = Q->parker().epoch();
+            auto res = Q->pop();
+            if (res.isOk()) { return res; }
+            if (disconnected()) {
+                auto retry = Q->pop();
+                if (retry.isOk()) { return retry; }
+                return core::err<T, MpscError>(MpscError::Sender);
+            }
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                return core::err<T, MpscError>(MpscError::EmptyQueue);
+            }
+            Q->parker().waitFor(e, deadline - now);
+        }
+    }
+
+    /**
+     * Move up to max_n values out of the channel, paying the queue synchronisation once.
+     * @param out output iterator receiving the values
+     * @param max_n maximum number of values to receive
+     * @return Number of received elements, zero when the channel is empty.
+     */
+    template<typename OutIt>
+    auto recv_batch(OutIt out, std::size_t max_n) -> core::Result<std::size_t, MpscError>
+    {
+        return Q->pop_batch(out, max_n);
+    }
+
+    /**
+     * Detach the entire ready backlog and hand it back as a plain range.
+     *
+     * The backlog is swapped out under one lock (or one atomic detach for the
+     * lock-free backends) and the returned vector is then iterated with zero
+     * synchronisation, instead of paying the queue synchronisation per element.
+     * @return Vector holding the drained values, empty when the channel was empty.
+     */
+    auto drain() -> std::vector<T>
+    {
+        std::vector<T> items;
+        Q->drain_all(std::back_inserter(items));
+        return items;
+    }
+
+    /**
+     * Apply F to every value of the current ready backlog.
+     *
+     * The backlog is detached once up front, so F runs without any queue
+     * synchronisation; values sent while F runs are left for the next call.
+     * @param F function receiving each value by rvalue reference
+     * @return Number of processed elements.
+     */
+    template<typename Func>
+    auto for_each(Func &&F) -> std::size_t
+    {
+        auto items = drain();
+        for (auto &item : items) {
+            F(std::move(item));
+        }
+        return items.size();
+    }
+
+
+#if defined(AID_HAS_COROUTINES)
+    /**
+     * Awaitable receive for coroutine consumers.
+     *
+     * co_await suspends the coroutine and parks its handle in the channel's Parker;
+     * the notify of the next send (or of the last sender hanging up) resumes it
+     * directly on the producer's thread, so no thread is blocked and no polling
+     * happens while the channel is empty.
+     * @return Awaitable yielding a Result<T, MpscError>.
+     */
+    auto recv_async() -> RecvAwaiter<T, CT, Backoff>
+    {
+        return RecvAwaiter<T, CT, Backoff>{*this};
+    }
+#endif
+
+    /**
+     * Access the channel's parking spot, used by the select engine.
+     * @return Parker shared by this channel's senders and consumer.
+     */
+    auto parker() -> Parker &
+    {
+        return Q->parker();
+    }
+
+private:
+    /// True once every Sender handle of this channel has been dropped.
+    [[nodiscard]] auto disconnected() const -> bool
+    {
+        return Q->hangup().senders() == 0;
+    }
+
+    std::shared_ptr<Queue> Q;
+};
+
+/**
+ * Receiver specialisation for the work-stealing multi-consumer channel.
+ *
+ * Every Receiver owns a local deque inside the shared queue; clone() registers an
+ * additional consumer on the same channel so one hot channel can be drained by many
+ * workers. Plain copying is deleted because two receivers must never share one local
+ * deque identity.
+ *
+ * @tparam T element type carried by the channel
+ * @tparam Backoff policy shaping the retry phase of the blocking receives
+ */
+template<typename T, typename Backoff>
+class Receiver<T, ChannelType::MpmcWorkStealing, Backoff>
+{
+public:
+    using Queue = typename ChannelTraits<T, ChannelType::MpmcWorkStealing>::Queue;
+
+    explicit Receiver(std::shared_ptr<Queue> queue)
+        : Q{std::move(queue)}, Worker{Q->registerWorker()}
+    {
+        Q->hangup().addReceiver();
+    }
+
+    Receiver(const Receiver &) = delete;
+    Receiver &operator=(const Receiver &) = delete;
+
+    Receiver(Receiver &&other) noexcept
+        : Q{std::move(other.Q)}, Worker{std::move(other.Worker)}
+    {}
+
+    Receiver &operator=(Receiver &&other) noexcept
+    {
+        if (this != &other) {
+            if (Q) { Q->hangup().dropReceiver(); }
+            Q = std::move(other.Q);
+            Worker = std::move(other.Worker);
+        }
+        return *this;
+    }
+
+    ~Receiver()
+    {
+        if (Q) { Q->hangup().dropReceiver(); }
+    }
+
+    /**
+     * Register an additional consumer on the same channel.
+     * @return A new Receiver with its own local deque.
+     */
+    [[nodiscard]] auto clone() const -> Receiver
+    {
+        return Receiver{Q};
+    }
+
+    /**
+     * Pop a value: local deque first, then the shared injector, then a steal from a peer.
+     * @return Ok with the value or MpscError::EmptyQueue when every source is dry.
+     */
+    auto recv() -> core::Result<T, MpscError>
+    {
+        auto res = Q->popFrom(Worker);
+        if (res.isOk() || Q->hangup().senders() > 0) {
+            return res;
+        }
+        auto retry = Q->popFrom(Worker);
+        if (retry.isOk()) { return retry; }
+        return core::err<T, MpscError>(MpscError::Sender);
+    }
+
+    /**
+     * Pop a value, parking the thread while every source is dry.
+     * @return Ok with the received value.
+     */
+    auto recv_blocking() -> core::Result<T, MpscError>
+    {
+        Backoff backoff;
+        do {
+            auto res = Q->popFrom(Worker);
+            if (res.isOk()) { return res; }
+        } while (backoff.snooze());
+        while (true) {
+            auto e = Q->parker().epoch();
+            auto res = Q->popFrom(Worker);
+            if (res.isOk()) { return res; }
+            if (Q->hangup().senders() == 0) {
+                auto retry = Q->popFrom(Worker);
+                if (retry.isOk()) { return retry; }
+                return core::err<T, MpscError>(MpscError::Sender);
+            }
+            Q->parker().wait(e);
+        }
+    }
+
+    /**
+     * Detach this consumer's local backlog plus the shared injector as a plain range.
+     *
+     * Each of the two locks is taken exactly once; peer deques are left alone.
+     * @return Vector holding the drained values, empty when both sources were dry.
+     */
+    auto drain() -> std::vector<T>
+    {
+        std::vector<T> items;
+        Q->drainFrom(Worker, std::back_inserter(items));
+        return items;
+    }
+
+    /**
+     * Apply F to every value of this consumer's current backlog.
+     * @param F function receiving each value by rvalue reference
+     * @return Number of processed elements.
+     */
+    template<typename Func>
+    auto for_each(Func &&F) -> std::size_t
+    {
+        auto items = drain();
+        for (auto &item : items) {
+            F(std::move(item));
+        }
+        return items.size();
+    }
+
+
+#if defined(AID_HAS_COROUTINES)
+    /**
+     * Awaitable receive for coroutine consumers.
+     *
+     * co_await suspends the coroutine and parks its handle in the channel's Parker;
+     * the notify of the next send (or of the last sender hanging up) resumes it
+     * directly on the producer's thread, so no thread is blocked and no polling
+     * happens while the channel is empty.
+     * @return Awaitable yielding a Result<T, MpscError>.
+     */
+    auto recv_async() -> RecvAwaiter<T, ChannelType::MpmcWorkStealing, Backoff>
+    {
+        return RecvAwaiter<T, ChannelType::MpmcWorkStealing, Backoff>{*this};
+    }
+#endif
+
+    /**
+     * Access the channel's parking spot, used by the select engine.
+     * @return Parker shared by this channel's senders and consumers.
+     */
+    auto parker() -> Parker &
+    {
+        return Q->parker();
+    }
+
+private:
+    std::shared_ptr<Queue> Q;
+    typename Queue::WorkerHandle Worker;
+};
+
+#if defined(AID_HAS_COROUTINES)
+/**
+ * Awaitable returned by Receiver::recv_async().
+ *
+ * await_ready tries an immediate pop; on an empty channel the coroutine suspends and
+ * its handle is armed behind the channel Parker's listener, so the notify that every
+ * send already performs resumes the coroutine in place of waking a thread. A notify
+ * that slips in between the failed pop and the listener install is detected through
+ * the Parker epoch and short-circuits the suspension. The armed flag lives in shared
+ * state owned by both the awaiter and the listener, so a late notify from a listener
+ * copy that outlives the await cannot touch a dead coroutine frame.
+ *
+ * @tparam T element type carried by the channel
+ * @tparam CT channel type selecting the queue backend
+ * @tparam Backoff policy shaping the retry phase of the blocking receives
+ */
+template<typename T, ChannelType CT, typename Backoff>
+class RecvAwaiter
+{
+public:
+    explicit RecvAwaiter(Receiver<T, CT, Backoff> &receiver)
+        : Recv{receiver}, State{std::make_shared<Waiter>()}
+    {}
+
+    auto await_ready() -> bool
+    {
+        Epoch = Recv.parker().epoch();
+        auto res = Recv.recv();
+        if (res.isOk() || res.containsErr(MpscError::Sender)) {
+            Ready.emplace(std::move(res));
+            return true;
+        }
+        return false;
+    }
+
+    auto await_suspend(std::coroutine_handle<> handle) -> bool
     {
-        return ::aid::core::ok<void>;
+        // once the listener is installed a producer's notify can win the race,
+        // resume the coroutine and destroy this awaiter on another thread, so
+        // everything used afterwards is copied into locals first
+        auto state = State;
+        auto *park = &Recv.parker();
+        auto epoch = Epoch;
+        state->Handle = handle;
+        state->Armed.store(true, std::memory_order_seq_cst);
+        park->setListener([state] {
+            auto expected = true;
+            if (state->Armed.compare_exchange_strong(expected, false, std::memory_order_seq_cst)) {
+                state->Handle.resume();
+            }
+        });
+        // a notify between the failed pop in await_ready and the listener install is
+        // only visible as an epoch bump; disarm and resume immediately in that case
+        if (park->epoch() != epoch) {
+            auto expected = true;
+            if (state->Armed.compare_exchange_strong(expected, false, std::memory_order_seq_cst)) {
+                park->clearListener();
+                return false;
+            }
+        }
+        return true;
     }
+
+    auto await_resume() -> core::Result<T, MpscError>
+    {
+        auto expected = true;
+        State->Armed.compare_exchange_strong(expected, false, std::memory_order_seq_cst);
+        Recv.parker().clearListener();
+        if (Ready.has_value()) {
+            return std::move(*Ready);
+        }
+        // the resume was preceded by a notify, so the value (or the hangup) is
+        // already visible and this returns without actually parking
+        return Recv.recv_blocking();
+    }
+
+private:
+    struct Waiter
+    {
+        std::atomic<bool> Armed{false};
+        std::coroutine_handle<> Handle;
+    };
+
+    Receiver<T, CT, Backoff> &Recv;
+    std::shared_ptr<Waiter> State;
+    std::optional<core::Result<T, MpscError>> Ready;
+    unsigned Epoch{0};
 };
+#endif
 }// namespace aid::mpsc
 
 #endif//AID_INCLUDE_AID_MPSC_RECEIVER_HPP
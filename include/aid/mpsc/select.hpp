@@ -0,0 +1,130 @@
+#ifndef AID_INCLUDE_AID_MPSC_SELECT_HPP
+#define AID_INCLUDE_AID_MPSC_SELECT_HPP
+
+#include <aid/mpsc/channel_type.hpp>
+#include <aid/mpsc/parker.hpp>
+#include <aid/mpsc/receiver.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace aid::mpsc
+{
+/**
+ * Waiter that multiplexes many Receivers and blocks once for all of them.
+ *
+ * Each registered channel's Parker gets a listener that flips the channel's bit in a
+ * shared readiness set, so a sender wakes the waiter in O(1) instead of the consumer
+ * round-robin polling every channel. A channel is considered ready when registered,
+ * so a backlog that existed before add() is never missed. Readiness is a hint: the
+ * woken caller performs the recv and simply selects again if another consumer (or an
+ * earlier wake) already drained the channel.
+ *
+ * The registered Receivers must outlive the SelectSet.
+ */
+class SelectSet
+{
+public:
+    SelectSet() : State{std::make_shared<Shared>()} {}
+
+    SelectSet(const SelectSet &) = delete;
+    SelectSet &operator=(const SelectSet &) = delete;
+
+    ~SelectSet()
+    {
+        for (auto *park : Parkers) {
+            park->clearListener();
+        }
+    }
+
+    /**
+     * Register a Receiver with the waiter.
+     * @param receiver channel half whose readiness should wake the waiter
+     * @return Index identifying the channel in wait() results.
+     */
+    template<typename T, ChannelType CT, typename Backoff>
+    auto add(Receiver<T, CT, Backoff> &receiver) -> std::size_t
+    {
+        auto index = Parkers.size();
+        auto &park = receiver.parker();
+        Parkers.push_back(&park);
+        {
+            std::scoped_lock lock(State->Mut);
+            State->Ready.push_back(true);
+        }
+        park.setListener([state = State, index] { state->signal(index); });
+        return index;
+    }
+
+    /**
+     * Block until one of the registered channels is ready.
+     * @return Index of the ready channel, with its readiness flag consumed.
+     */
+    auto wait() -> std::size_t
+    {
+        std::unique_lock lock(State->Mut);
+        std::size_t index = 0;
+        State->Cv.wait(lock, [&] { return findReady(index); });
+        State->Ready[index] = false;
+        return index;
+    }
+
+    /**
+     * Block until one of the registered channels is ready or the timeout expires.
+     * @param timeout maximum time to wait
+     * @return Index of the ready channel or an empty optional on timeout.
+     */
+    template<typename Rep, typename Period>
+    auto waitFor(const std::chrono::duration<Rep, Period> &timeout) -> std::optional<std::size_t>
+    {
+        std::unique_lock lock(State->Mut);
+        std::size_t index = 0;
+        if (!State->Cv.wait_for(lock, timeout, [&] { return findReady(index); })) {
+            return std::nullopt;
+        }
+        State->Ready[index] = false;
+        return index;
+    }
+
+private:
+    struct Shared
+    {
+        std::mutex Mut;
+        std::condition_variable Cv;
+        std::vector<bool> Ready;
+
+        void signal(std::size_t index)
+        {
+            {
+                std::scoped_lock lock(Mut);
+                Ready[index] = true;
+            }
+            Cv.notify_all();
+        }
+    };
+
+    /// Scan for a ready channel, starting after the last winner so channels take turns.
+    auto findReady(std::size_t &index) -> bool
+    {
+        auto n = State->Ready.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            auto candidate = (Last + 1 + i) % n;
+            if (State->Ready[candidate]) {
+                index = candidate;
+                Last = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::shared_ptr<Shared> State;
+    std::vector<Parker *> Parkers;
+    std::size_t Last = 0;
+};
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_SELECT_HPP
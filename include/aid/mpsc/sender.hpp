@@ -2,18 +2,135 @@
 #define AID_INCLUDE_AID_MPSC_SENDER_HPP
 
 #include <aid/core/result.hpp>
+#include <aid/mpsc/channel_traits.hpp>
 #include <aid/mpsc/channel_type.hpp>
+#include <aid/mpsc/mpsc_error.hpp>
+#include <memory>
 
 namespace aid::mpsc
 {
-template<typename T, ChannelType CT=ChannelType::OneShot>
+/**
+ * Sending half of a channel.
+ *
+ * A Sender only moves values into the queue backend selected by the channel type.
+ * Instances are created by the channel() factory in channel.hpp.
+ *
+ * @tparam T element type carried by the channel
+ * @tparam CT channel type selecting the queue backend
+ */
+template<typename T, ChannelType CT = ChannelType::OneShot>
+class Sender
 {
 public:
-    auto send(T && t)->Result<std::void_t, SenderError<T>>
+    using Queue = typename ChannelTraits<T, CT>::Queue;
+
+    explicit Sender(std::shared_ptr<Queue> queue) : Q{std::move(queue)}
+    {
+        Q->hangup().addSender();
+    }
+
+    Sender(const Sender &other) : Q{other.Q}
+    {
+        if (Q) { Q->hangup().addSender(); }
+    }
+
+    Sender &operator=(const Sender &other)
     {
-        return ok(void);
+        if (this != &other) {
+            release();
+            Q = other.Q;
+            if (Q) { Q->hangup().addSender(); }
+        }
+        return *this;
     }
-}
+
+    Sender(Sender &&other) noexcept : Q{std::move(other.Q)} {}
+
+    Sender &operator=(Sender &&other) noexcept
+    {
+        if (this != &other) {
+            release();
+            Q = std::move(other.Q);
+        }
+        return *this;
+    }
+
+    ~Sender() { release(); }
+
+    /**
+     * Move a value into the channel.
+     *
+     * If the queue rejects the value (e.g. a bounded queue is full) or the receiver is
+     * gone, ownership travels back to the caller inside the SenderError; reason()
+     * distinguishes the two cases.
+     * @param t value being moved into the channel
+     * @return Ok on success or a SenderError holding the undelivered value.
+     */
+    auto send(T &&t) -> core::Result<void, SenderError<T>>
+    {
+        if (Q->hangup().receivers() == 0) {
+            return core::err<void, SenderError<T>>(
+                SenderError<T>{std::move(t), MpscError::Receiver});
+        }
+        auto res = Q->push(std::move(t));
+        if (res.isOk()) {
+            return core::ok<void, SenderError<T>>();
+        }
+        // push leaves the argument untouched on failure, so t still owns the value
+        // here; the queue's error code keeps a full-queue rejection apart from a
+        // receiver that dropped while a Block producer was parked
+        return core::err<void, SenderError<T>>(SenderError<T>{std::move(t), res.err()});
+    }
+
+    /**
+     * Construct a value directly inside the channel from the given arguments.
+     *
+     * The value is forward-constructed into the queue's own storage, so the producer
+     * never builds it on its stack and nothing is moved. Since no value exists on
+     * failure there is nothing to hand back; the error is the plain reason code.
+     * @param args constructor arguments forwarded to T
+     * @return Ok on success, MpscError::Receiver if the receiver is gone or
+     *         MpscError::FullQueue if a bounded queue has no free slot.
+     */
+    template<typename... Args>
+    auto send_emplace(Args &&...args) -> core::Result<void, MpscError>
+    {
+        if (Q->hangup().receivers() == 0) {
+            return core::err<void, MpscError>(MpscError::Receiver);
+        }
+        return Q->emplace(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Move a range of values into the channel, paying the queue synchronisation once.
+     *
+     * Elements a bounded queue cannot accept are left untouched in the input range,
+     * so the caller can retry the tail of the range.
+     * @param first begin of the range being moved into the channel
+     * @param last end of the range
+     * @return Number of accepted elements.
+     */
+    template<typename It>
+    auto send_batch(It first, It last) -> core::Result<std::size_t, MpscError>
+    {
+        if (Q->hangup().receivers() == 0) {
+            return core::err<std::size_t, MpscError>(MpscError::Receiver);
+        }
+        return Q->push_batch(first, last);
+    }
+
+private:
+    /// Drop this handle; the last sender wakes a parked consumer so it sees the hangup.
+    void release()
+    {
+        if (Q && Q->hangup().dropSender()) {
+            Q->parker().notify();
+        }
+        Q.reset();
+    }
+
+    std::shared_ptr<Queue> Q;
+};
 }// namespace aid::mpsc
 
 #endif//AID_INCLUDE_AID_MPSC_SENDER_HPP
@@ -0,0 +1,269 @@
+#ifndef AID_INCLUDE_AID_MPSC_SPSC_RING_BUFFER_HPP
+#define AID_INCLUDE_AID_MPSC_SPSC_RING_BUFFER_HPP
+
+#include <aid/core/result.hpp>
+#include <aid/mpsc/cache_line.hpp>
+#include <aid/mpsc/hangup.hpp>
+#include <aid/mpsc/mpsc_error.hpp>
+#include <aid/mpsc/parker.hpp>
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace aid::mpsc
+{
+/**
+ * Fixed-capacity lock-free ring buffer for a single producer and a single consumer.
+ *
+ * The capacity is rounded up to the next power of two so slot lookup is a mask instead
+ * of a modulo. Head and tail indices only ever increase and are read with acquire and
+ * written with release ordering, which is all the synchronisation a strict SPSC pair needs.
+ * Both indices live on their own cache line so the producer and consumer do not
+ * invalidate each other's line on every operation.
+ *
+ * Trivially copyable payloads take a raw-copy path: single transfers compile down to
+ * a plain copy with no destructor bookkeeping, and batch transfers through pointers
+ * move whole contiguous runs with one memcpy per side of the wrap point.
+ *
+ * @tparam T element type stored in the ring
+ */
+template<typename T>
+class SpscRingBuffer
+{
+public:
+    /**
+     * Construct a ring buffer with at least the requested capacity.
+     * @param capacity minimum number of elements the ring can hold, rounded up to a power of two
+     */
+    explicit SpscRingBuffer(std::size_t capacity)
+        : Mask{roundUpPowerOfTwo(capacity) - 1},
+          Slots{new Slot[Mask + 1]},
+          OwnsSlots{true}
+    {}
+
+    /**
+     * Construct a ring buffer over caller-provided slot storage.
+     *
+     * The storage must hold at least requiredSlotBytes(capacity) bytes aligned to
+     * alignof(T); it is not released by the ring and must outlive it.
+     * @param capacity minimum number of elements the ring can hold, rounded up to a power of two
+     * @param slots caller-provided storage for the slots
+     */
+    SpscRingBuffer(std::size_t capacity, void *slots)
+        : Mask{roundUpPowerOfTwo(capacity) - 1},
+          Slots{static_cast<Slot *>(slots)},
+          OwnsSlots{false}
+    {}
+
+    SpscRingBuffer(const SpscRingBuffer &) = delete;
+    SpscRingBuffer &operator=(const SpscRingBuffer &) = delete;
+
+    ~SpscRingBuffer()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            auto head = Head.load(std::memory_order_relaxed);
+            auto tail = Tail.load(std::memory_order_relaxed);
+            for (; head != tail; ++head) {
+                slot(head)->~T();
+            }
+        }
+        if (OwnsSlots) {
+            delete[] Slots;
+        }
+    }
+
+    /**
+     * Number of slot bytes a caller-provided buffer must hold for a given capacity.
+     * @param capacity minimum number of elements the ring should hold
+     * @return Required size in bytes after rounding the capacity up to a power of two.
+     */
+    static constexpr auto requiredSlotBytes(std::size_t capacity) -> std::size_t
+    {
+        return roundUpPowerOfTwo(capacity) * sizeof(Slot);
+    }
+
+    /**
+     * Push a value into the ring.
+     *
+     * If the ring is full, the argument is left untouched so the caller keeps ownership.
+     * @param value data being moved into the ring
+     * @return Ok on success or MpscError::FullQueue if no slot is free.
+     */
+    auto push(T &&value) -> core::Result<void, MpscError>
+    {
+        auto tail = Tail.load(std::memory_order_relaxed);
+        if (tail - Head.load(std::memory_order_acquire) == Mask + 1) {
+            return core::err<void, MpscError>(MpscError::FullQueue);
+        }
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            std::memcpy(slot(tail), &value, sizeof(T));
+        }
+        else {
+            new (slot(tail)) T(std::move(value));
+        }
+        Tail.store(tail + 1, std::memory_order_release);
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Construct a value directly inside a free slot from the given arguments.
+     *
+     * Skips the stack-side construction and the move that push() needs.
+     * @param args constructor arguments forwarded to T
+     * @return Ok on success or MpscError::FullQueue if no slot is free.
+     */
+    template<typename... Args>
+    auto emplace(Args &&...args) -> core::Result<void, MpscError>
+    {
+        auto tail = Tail.load(std::memory_order_relaxed);
+        if (tail - Head.load(std::memory_order_acquire) == Mask + 1) {
+            return core::err<void, MpscError>(MpscError::FullQueue);
+        }
+        new (slot(tail)) T(std::forward<Args>(args)...);
+        Tail.store(tail + 1, std::memory_order_release);
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Pop the oldest value out of the ring.
+     * @return Ok with the value or MpscError::EmptyQueue if the ring is empty.
+     */
+    auto pop() -> core::Result<T, MpscError>
+    {
+        auto head = Head.load(std::memory_order_relaxed);
+        if (head == Tail.load(std::memory_order_acquire)) {
+            return core::err<T, MpscError>(MpscError::EmptyQueue);
+        }
+        auto *p = slot(head);
+        auto owner = std::move(*p);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            p->~T();
+        }
+        Head.store(head + 1, std::memory_order_release);
+        return core::ok<T, MpscError>(std::move(owner));
+    }
+
+    /**
+     * Push a range of values with a single head load and a single tail publish.
+     *
+     * Elements that do not fit are left untouched in the input range.
+     * @param first begin of the range being moved into the ring
+     * @param last end of the range
+     * @return Number of accepted elements, limited by the free space in the ring.
+     */
+    template<typename It>
+    auto push_batch(It first, It last) -> core::Result<std::size_t, MpscError>
+    {
+        auto tail = Tail.load(std::memory_order_relaxed);
+        auto free = Mask + 1 - (tail - Head.load(std::memory_order_acquire));
+        std::size_t n = 0;
+        if constexpr (std::is_trivially_copyable_v<T> && std::is_pointer_v<It>) {
+            auto count = static_cast<std::size_t>(last - first);
+            n = count < free ? count : free;
+            // at most two contiguous runs: up to the physical end of the ring, then
+            // from its start
+            auto idx = tail & Mask;
+            auto first_run = n < Mask + 1 - idx ? n : Mask + 1 - idx;
+            std::memcpy(&Slots[idx], first, first_run * sizeof(T));
+            std::memcpy(&Slots[0], first + first_run, (n - first_run) * sizeof(T));
+        }
+        else {
+            for (; first != last && n < free; ++first, ++n) {
+                new (slot(tail + n)) T(std::move(*first));
+            }
+        }
+        Tail.store(tail + n, std::memory_order_release);
+        if (n > 0) { Park.notify(); }
+        return core::ok<std::size_t, MpscError>(std::move(n));
+    }
+
+    /**
+     * Pop up to max_n values with a single tail load and a single head publish.
+     * @param out output iterator receiving the popped values
+     * @param max_n maximum number of values to pop
+     * @return Number of popped elements, zero when the ring is empty.
+     */
+    template<typename OutIt>
+    auto pop_batch(OutIt out, std::size_t max_n) -> core::Result<std::size_t, MpscError>
+    {
+        auto head = Head.load(std::memory_order_relaxed);
+        auto available = Tail.load(std::memory_order_acquire) - head;
+        auto n = available < max_n ? available : max_n;
+        if constexpr (std::is_trivially_copyable_v<T> && std::is_pointer_v<OutIt>) {
+            auto idx = head & Mask;
+            auto first_run = n < Mask + 1 - idx ? n : Mask + 1 - idx;
+            std::memcpy(out, &Slots[idx], first_run * sizeof(T));
+            std::memcpy(out + first_run, &Slots[0], (n - first_run) * sizeof(T));
+        }
+        else {
+            for (std::size_t i = 0; i < n; ++i) {
+                auto *p = slot(head + i);
+                *out++ = std::move(*p);
+                if constexpr (!std::is_trivially_destructible_v<T>) {
+                    p->~T();
+                }
+            }
+        }
+        Head.store(head + n, std::memory_order_release);
+        return core::ok<std::size_t, MpscError>(std::move(n));
+    }
+
+    /**
+     * Move the entire ready backlog out with one tail load and one head publish.
+     * @param out output iterator receiving the values
+     * @return Number of drained elements.
+     */
+    template<typename OutIt>
+    auto drain_all(OutIt out) -> std::size_t
+    {
+        return pop_batch(out, Mask + 1).value();
+    }
+
+    /**
+     * Number of elements the ring can hold.
+     * @return Capacity of the ring after rounding up to a power of two.
+     */
+    [[nodiscard]] auto capacity() const -> std::size_t { return Mask + 1; }
+
+    /**
+     * Parking spot used by a consumer that wants to block instead of spinning.
+     * @return Parker shared between the producer and the consumer of this ring.
+     */
+    auto parker() -> Parker & { return Park; }
+
+    /**
+     * Handle counts used by Sender and Receiver to detect a hangup.
+     * @return Hangup state shared by every handle of this channel.
+     */
+    auto hangup() -> detail::Hangup & { return Hang; }
+
+private:
+    using Slot = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+    static constexpr auto roundUpPowerOfTwo(std::size_t n) -> std::size_t
+    {
+        std::size_t power = 1;
+        while (power < n) { power <<= 1u; }
+        return power;
+    }
+
+    auto slot(std::size_t index) -> T *
+    {
+        return reinterpret_cast<T *>(&Slots[index & Mask]);
+    }
+
+    alignas(CacheLineSize) std::atomic<std::size_t> Head{0};
+    alignas(CacheLineSize) std::atomic<std::size_t> Tail{0};
+    std::size_t Mask;
+    Slot *Slots;
+    bool OwnsSlots;
+    Parker Park;
+    detail::Hangup Hang;
+};
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_SPSC_RING_BUFFER_HPP
@@ -0,0 +1,290 @@
+#ifndef AID_INCLUDE_AID_MPSC_TOPOLOGY_HPP
+#define AID_INCLUDE_AID_MPSC_TOPOLOGY_HPP
+
+#include <aid/mpsc/backoff.hpp>
+#include <aid/mpsc/channel.hpp>
+#include <aid/mpsc/select.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace aid::mpsc
+{
+/**
+ * Merged consuming end over several source channels.
+ *
+ * Replaces the hand-built fan-in pattern of draining N receivers into yet another
+ * channel: the sources are polled in rotating order directly, so no message crosses
+ * an extra queue on its way to the consumer and no forwarding thread is needed.
+ * Values of one source keep their order; sources are interleaved fairly.
+ *
+ * @tparam T element type carried by the source channels
+ * @tparam CT channel type of the sources
+ * @tparam Backoff backoff policy of the sources
+ */
+template<typename T, ChannelType CT = ChannelType::UnboundedLockFree,
+         typename Backoff = AdaptiveBackoff>
+class FanIn
+{
+public:
+    /**
+     * Take ownership of the source receivers.
+     * @param sources receiving halves being merged; moved into the fan-in
+     */
+    explicit FanIn(std::vector<Receiver<T, CT, Backoff>> sources)
+        : Sources{std::move(sources)}
+    {
+        for (auto &src : Sources) {
+            Select.add(src);
+        }
+    }
+
+    /**
+     * Receive the next value from any source, without blocking.
+     *
+     * The sources are visited in rotating order starting after the one that
+     * delivered last, so a busy source cannot starve the others.
+     * @return Ok with a value, MpscError::EmptyQueue when every source is empty or
+     *         MpscError::Sender once every source has lost all its senders.
+     */
+    auto recv() -> core::Result<T, MpscError>
+    {
+        auto n = Sources.size();
+        bool all_disconnected = true;
+        for (std::size_t i = 0; i < n; ++i) {
+            auto idx = (Next + i) % n;
+            auto res = Sources[idx].recv();
+            if (res.isOk()) {
+                Next = idx + 1;
+                return res;
+            }
+            if (!res.containsErr(MpscError::Sender)) {
+                all_disconnected = false;
+            }
+        }
+        if (all_disconnected) {
+            return core::err<T, MpscError>(MpscError::Sender);
+        }
+        return core::err<T, MpscError>(MpscError::EmptyQueue);
+    }
+
+    /**
+     * Receive the next value from any source, blocking until one arrives.
+     *
+     * Spins through the backoff budget first, then parks on all source parkers at
+     * once until one of them signals.
+     * @return Ok with a value or MpscError::Sender once every source is disconnected.
+     */
+    auto recv_blocking() -> core::Result<T, MpscError>
+    {
+        Backoff backoff;
+        do {
+            auto res = recv();
+            if (res.isOk() || res.containsErr(MpscError::Sender)) {
+                return res;
+            }
+        } while (backoff.snooze());
+        for (;;) {
+            auto res = recv();
+            if (res.isOk() || res.containsErr(MpscError::Sender)) {
+                return res;
+            }
+            Select.waitFor(std::chrono::milliseconds(1));
+        }
+    }
+
+    /**
+     * Move every ready value out of every source.
+     * @return Drained values, source by source, in per-source order.
+     */
+    auto drain() -> std::vector<T>
+    {
+        std::vector<T> out;
+        for (auto &src : Sources) {
+            auto part = src.drain();
+            for (auto &value : part) {
+                out.push_back(std::move(value));
+            }
+        }
+        return out;
+    }
+
+    /// Number of merged sources.
+    [[nodiscard]] auto size() const -> std::size_t { return Sources.size(); }
+
+private:
+    std::vector<Receiver<T, CT, Backoff>> Sources;
+    SelectSet Select;
+    std::size_t Next{0};
+};
+
+/**
+ * Merge several receiving halves into one fan-in consumer.
+ * @tparam T element type carried by the source channels
+ * @tparam CT channel type of the sources
+ * @tparam Backoff backoff policy of the sources
+ * @param sources receiving halves being merged; moved into the fan-in
+ * @return FanIn owning the sources.
+ */
+template<typename T, ChannelType CT, typename Backoff>
+auto fan_in(std::vector<Receiver<T, CT, Backoff>> sources) -> FanIn<T, CT, Backoff>
+{
+    return FanIn<T, CT, Backoff>{std::move(sources)};
+}
+
+/**
+ * Sending end split over n sub-channels by a user-supplied routing function.
+ *
+ * Each value is routed to shard `route(value) % n`, so related values (same key,
+ * same flow) always land in the same sub-queue and stay ordered relative to each
+ * other. One consumer per shard takes its receiving half out of receivers().
+ *
+ * @tparam T element type carried by the shard channels
+ * @tparam RoutingFn function mapping const T& to an integral shard key
+ * @tparam CT channel type of the shards
+ * @tparam Backoff backoff policy of the shard receivers
+ */
+template<typename T, typename RoutingFn, ChannelType CT = ChannelType::UnboundedLockFree,
+         typename Backoff = AdaptiveBackoff>
+class FanOut
+{
+public:
+    /**
+     * Create the shard channels.
+     * @param shards number of sub-channels
+     * @param route function mapping a value to its shard key
+     */
+    FanOut(std::size_t shards, RoutingFn route) : Route{std::move(route)}
+    {
+        Senders.reserve(shards);
+        Receivers.reserve(shards);
+        for (std::size_t i = 0; i < shards; ++i) {
+            auto [tx, rx] = channel<T, CT, Backoff>();
+            Senders.push_back(std::move(tx));
+            Receivers.push_back(std::move(rx));
+        }
+    }
+
+    /**
+     * Route a value to its shard and send it there.
+     * @param value data being moved into the routed shard
+     * @return Ok on success or a SenderError returning the value on failure.
+     */
+    auto send(T &&value) -> core::Result<void, SenderError<T>>
+    {
+        auto shard = static_cast<std::size_t>(Route(value)) % Senders.size();
+        return Senders[shard].send(std::move(value));
+    }
+
+    /// Number of sub-channels.
+    [[nodiscard]] auto shards() const -> std::size_t { return Senders.size(); }
+
+    /// Receiving halves of the shards; consumers move their element out.
+    auto receivers() -> std::vector<Receiver<T, CT, Backoff>> & { return Receivers; }
+
+private:
+    RoutingFn Route;
+    std::vector<Sender<T, CT>> Senders;
+    std::vector<Receiver<T, CT, Backoff>> Receivers;
+};
+
+/**
+ * Split a stream over n sub-channels keyed by a routing function.
+ * @tparam T element type carried by the shard channels
+ * @tparam CT channel type of the shards
+ * @tparam Backoff backoff policy of the shard receivers
+ * @param shards number of sub-channels
+ * @param route function mapping a value to its shard key
+ * @return FanOut owning the shard channels.
+ */
+template<typename T, ChannelType CT = ChannelType::UnboundedLockFree,
+         typename Backoff = AdaptiveBackoff, typename RoutingFn>
+auto fan_out(std::size_t shards, RoutingFn route) -> FanOut<T, RoutingFn, CT, Backoff>
+{
+    return FanOut<T, RoutingFn, CT, Backoff>{shards, std::move(route)};
+}
+
+/**
+ * Affinity-aware shard router: every producer thread sticks to one sub-queue.
+ *
+ * A producer is assigned a shard round-robin on its first send and keeps using that
+ * shard for the lifetime of the router, found through a thread-local table like the
+ * stats shards. When producer threads are pinned to NUMA nodes and the router is
+ * created with one shard per node, all of a producer's channel traffic stays on the
+ * cache lines of its own node instead of bouncing across the socket interconnect.
+ *
+ * @tparam T element type carried by the shard channels
+ * @tparam CT channel type of the shards
+ * @tparam Backoff backoff policy of the shard receivers
+ */
+template<typename T, ChannelType CT = ChannelType::UnboundedLockFree,
+         typename Backoff = AdaptiveBackoff>
+class ShardRouter
+{
+public:
+    /**
+     * Create the shard channels.
+     * @param shards number of sub-channels, typically one per NUMA node
+     */
+    explicit ShardRouter(std::size_t shards)
+        : Id{NextId.fetch_add(1, std::memory_order_relaxed)}
+    {
+        Senders.reserve(shards);
+        Receivers.reserve(shards);
+        for (std::size_t i = 0; i < shards; ++i) {
+            auto [tx, rx] = channel<T, CT, Backoff>();
+            Senders.push_back(std::move(tx));
+            Receivers.push_back(std::move(rx));
+        }
+    }
+
+    ShardRouter(const ShardRouter &) = delete;
+    ShardRouter &operator=(const ShardRouter &) = delete;
+
+    /**
+     * Send a value through the calling thread's pinned shard.
+     * @param value data being moved into the pinned shard
+     * @return Ok on success or a SenderError returning the value on failure.
+     */
+    auto send(T &&value) -> core::Result<void, SenderError<T>>
+    {
+        return Senders[myShard()].send(std::move(value));
+    }
+
+    /**
+     * Shard the calling thread is pinned to, assigning one on first use.
+     * @return Index of this thread's shard.
+     */
+    auto myShard() -> std::size_t
+    {
+        // keyed by a process-unique router id, so a router reusing the address of a
+        // destroyed one can never inherit a stale assignment
+        thread_local std::unordered_map<std::uint64_t, std::size_t> local;
+        auto it = local.find(Id);
+        if (it == local.end()) {
+            auto shard = NextShard.fetch_add(1, std::memory_order_relaxed) % Senders.size();
+            it = local.emplace(Id, shard).first;
+        }
+        return it->second;
+    }
+
+    /// Number of sub-channels.
+    [[nodiscard]] auto shards() const -> std::size_t { return Senders.size(); }
+
+    /// Receiving halves of the shards; consumers move their element out.
+    auto receivers() -> std::vector<Receiver<T, CT, Backoff>> & { return Receivers; }
+
+private:
+    std::vector<Sender<T, CT>> Senders;
+    std::vector<Receiver<T, CT, Backoff>> Receivers;
+    std::uint64_t Id;
+    std::atomic<std::size_t> NextShard{0};
+
+    static inline std::atomic<std::uint64_t> NextId{1};
+};
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_TOPOLOGY_HPP
@@ -0,0 +1,219 @@
+#ifndef AID_INCLUDE_AID_MPSC_WORK_STEALING_QUEUE_HPP
+#define AID_INCLUDE_AID_MPSC_WORK_STEALING_QUEUE_HPP
+
+#include <aid/core/result.hpp>
+#include <aid/mpsc/hangup.hpp>
+#include <aid/mpsc/mpsc_error.hpp>
+#include <aid/mpsc/parker.hpp>
+#include <deque>
+#include <utility>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace aid::mpsc
+{
+/**
+ * Multi-producer multi-consumer queue with per-consumer local deques and work stealing.
+ *
+ * Producers feed a shared injector deque. Each consumer owns a local deque and serves
+ * requests from its front; when it runs dry it refills a batch from the injector, and
+ * only when the injector is also empty does it steal half the backlog of a peer. The
+ * local deque keeps the common case a single uncontended lock, the batch refill
+ * amortises injector contention, and stealing keeps idle consumers busy when the load
+ * is skewed.
+ *
+ * @tparam T element type carried by the queue
+ */
+template<typename T>
+class WorkStealingQueue
+{
+public:
+    struct Local
+    {
+        std::mutex Mut;
+        std::deque<T> Items;
+    };
+    using WorkerHandle = std::shared_ptr<Local>;
+
+    /**
+     * Register a new consumer and hand it its local deque.
+     * @return Handle to the consumer's local deque.
+     */
+    auto registerWorker() -> WorkerHandle
+    {
+        auto local = std::make_shared<Local>();
+        std::scoped_lock lock(WorkersMut);
+        Workers.push_back(local);
+        return local;
+    }
+
+    /**
+     * Push a value into the shared injector.
+     * @param value data being moved into the queue
+     * @return Always Ok; the injector is unbounded.
+     */
+    auto push(T &&value) -> core::Result<void, MpscError>
+    {
+        {
+            std::scoped_lock lock(InjectorMut);
+            Injector.push_back(std::move(value));
+        }
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Construct a value directly inside the shared injector from the given arguments.
+     *
+     * Skips the stack-side construction and the move that push() needs.
+     * @param args constructor arguments forwarded to T
+     * @return Always Ok; the injector is unbounded.
+     */
+    template<typename... Args>
+    auto emplace(Args &&...args) -> core::Result<void, MpscError>
+    {
+        {
+            std::scoped_lock lock(InjectorMut);
+            Injector.emplace_back(std::forward<Args>(args)...);
+        }
+        Park.notify();
+        return core::ok<void, MpscError>();
+    }
+
+    /**
+     * Push a range of values into the shared injector while taking its lock only once.
+     * @param first begin of the range being moved into the queue
+     * @param last end of the range
+     * @return Number of accepted elements; the injector is unbounded.
+     */
+    template<typename It>
+    auto push_batch(It first, It last) -> core::Result<std::size_t, MpscError>
+    {
+        std::size_t n = 0;
+        {
+            std::scoped_lock lock(InjectorMut);
+            for (; first != last; ++first, ++n) {
+                Injector.push_back(std::move(*first));
+            }
+        }
+        if (n > 0) { Park.notify(); }
+        return core::ok<std::size_t, MpscError>(std::move(n));
+    }
+
+    /**
+     * Pop a value on behalf of the given consumer: local deque first, then a batch
+     * from the injector, then half the backlog of a peer.
+     * @param me local deque handle of the calling consumer
+     * @return Ok with a value or MpscError::EmptyQueue when every source is dry.
+     */
+    auto popFrom(const WorkerHandle &me) -> core::Result<T, MpscError>
+    {
+        {
+            std::scoped_lock lock(me->Mut);
+            if (!me->Items.empty()) {
+                auto owner = std::move(me->Items.front());
+                me->Items.pop_front();
+                return core::ok<T, MpscError>(std::move(owner));
+            }
+        }
+        {
+            std::scoped_lock lock(InjectorMut);
+            if (!Injector.empty()) {
+                auto owner = std::move(Injector.front());
+                Injector.pop_front();
+                auto refill = Injector.size() < RefillBatch ? Injector.size() : RefillBatch;
+                if (refill > 0) {
+                    std::scoped_lock local_lock(me->Mut);
+                    for (; refill > 0; --refill) {
+                        me->Items.push_back(std::move(Injector.front()));
+                        Injector.pop_front();
+                    }
+                }
+                return core::ok<T, MpscError>(std::move(owner));
+            }
+        }
+        std::vector<WorkerHandle> peers;
+        {
+            std::scoped_lock lock(WorkersMut);
+            peers = Workers;
+        }
+        for (auto &peer : peers) {
+            if (peer == me) { continue; }
+            std::vector<T> loot;
+            {
+                std::scoped_lock lock(peer->Mut);
+                auto take = (peer->Items.size() + 1) / 2;
+                for (; take > 0; --take) {
+                    loot.push_back(std::move(peer->Items.back()));
+                    peer->Items.pop_back();
+                }
+            }
+            if (!loot.empty()) {
+                auto owner = std::move(loot.front());
+                if (loot.size() > 1) {
+                    std::scoped_lock lock(me->Mut);
+                    for (auto it = loot.begin() + 1; it != loot.end(); ++it) {
+                        me->Items.push_back(std::move(*it));
+                    }
+                }
+                return core::ok<T, MpscError>(std::move(owner));
+            }
+        }
+        return core::err<T, MpscError>(MpscError::EmptyQueue);
+    }
+
+    /**
+     * Move the calling consumer's local backlog plus the whole injector out, taking
+     * each of the two locks exactly once. Peer deques are left alone.
+     * @param me local deque handle of the calling consumer
+     * @param out output iterator receiving the values
+     * @return Number of drained elements.
+     */
+    template<typename OutIt>
+    auto drainFrom(const WorkerHandle &me, OutIt out) -> std::size_t
+    {
+        std::size_t n = 0;
+        {
+            std::scoped_lock lock(me->Mut);
+            for (; !me->Items.empty(); ++n) {
+                *out++ = std::move(me->Items.front());
+                me->Items.pop_front();
+            }
+        }
+        {
+            std::scoped_lock lock(InjectorMut);
+            for (; !Injector.empty(); ++n) {
+                *out++ = std::move(Injector.front());
+                Injector.pop_front();
+            }
+        }
+        return n;
+    }
+
+    /**
+     * Parking spot used by consumers that want to block instead of spinning.
+     * @return Parker shared between the producers and the consumers of this queue.
+     */
+    auto parker() -> Parker & { return Park; }
+
+    /**
+     * Handle counts used by Sender and Receiver to detect a hangup.
+     * @return Hangup state shared by every handle of this channel.
+     */
+    auto hangup() -> detail::Hangup & { return Hang; }
+
+private:
+    /// Number of injector elements moved to a local deque per refill.
+    static constexpr std::size_t RefillBatch = 32;
+
+    std::deque<T> Injector;
+    std::mutex InjectorMut;
+    std::vector<WorkerHandle> Workers;
+    std::mutex WorkersMut;
+    Parker Park;
+    detail::Hangup Hang;
+};
+}// namespace aid::mpsc
+
+#endif//AID_INCLUDE_AID_MPSC_WORK_STEALING_QUEUE_HPP
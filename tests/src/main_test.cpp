@@ -22,4 +22,4 @@ int main( int argc, char* argv[] )
     // This clamping has already been applied, so just return it here
     // You can also do any post run clean-up here
     return numFailed;
-}
\ No newline at end of file
+}
@@ -0,0 +1,695 @@
+#include <aid/mpsc/mpsc.hpp>
+#include <chrono>
+#include <atomic>
+#include <cstddef>
+#include <catch2/catch.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace aid::mpsc;
+
+TEST_CASE("Send and receive through a channel", "[mpsc]")
+{
+    auto [tx, rx] = channel<int>();
+    REQUIRE(tx.send(5).isOk());
+    auto res = rx.recv();
+    REQUIRE(res.isOk());
+    REQUIRE(res.value() == 5);
+    REQUIRE(rx.recv().containsErr(MpscError::EmptyQueue));
+}
+
+TEST_CASE("Bounded SPSC channel rejects pushes beyond its capacity", "[mpsc]")
+{
+    auto [tx, rx] = channel<int, ChannelType::BoundedSpsc>(4);
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(tx.send(std::move(i)).isOk());
+    }
+    int overflow = 99;
+    REQUIRE(tx.send(std::move(overflow)).isErr());
+    for (int i = 0; i < 4; ++i) {
+        auto res = rx.recv();
+        REQUIRE(res.isOk());
+        REQUIRE(res.value() == i);
+    }
+    REQUIRE(rx.recv().containsErr(MpscError::EmptyQueue));
+}
+
+TEST_CASE("Bounded SPSC channel transfers values between two threads", "[mpsc]")
+{
+    constexpr int n = 10000;
+    auto [tx, rx] = channel<int, ChannelType::BoundedSpsc>(64);
+    auto producer = std::thread([tx = std::move(tx)]() mutable {
+        for (int i = 0; i < n; ++i) {
+            auto value = i;
+            while (true) {
+                auto res = tx.send(std::move(value));
+                if (res.isOk()) break;
+                std::this_thread::yield();
+            }
+        }
+    });
+    int expected = 0;
+    while (expected < n) {
+        auto res = rx.recv();
+        if (res.isOk()) {
+            REQUIRE(res.value() == expected);
+            ++expected;
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
+
+TEST_CASE("Lock-free MPSC channel keeps per-producer order under contention", "[mpsc]")
+{
+    constexpr int producers = 4;
+    constexpr int per_producer = 5000;
+    auto [tx, rx] = channel<std::pair<int, int>, ChannelType::UnboundedLockFree>();
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([tx, p]() mutable {
+            for (int i = 0; i < per_producer; ++i) {
+                // Catch2 assertions are not thread-safe, so the producer threads only send.
+                static_cast<void>(tx.send(std::pair{p, i}));
+            }
+        });
+    }
+    std::vector<int> next_expected(producers, 0);
+    int received = 0;
+    while (received < producers * per_producer) {
+        auto res = rx.recv();
+        if (res.isOk()) {
+            auto [p, i] = res.value();
+            REQUIRE(next_expected[p] == i);
+            ++next_expected[p];
+            ++received;
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+    for (auto &t : threads) { t.join(); }
+    REQUIRE(rx.recv().containsErr(MpscError::EmptyQueue));
+}
+
+TEST_CASE("Batch send and receive splice elements in bulk", "[mpsc]")
+{
+    auto [tx, rx] = channel<int, ChannelType::BoundedSpsc>(8);
+    std::vector<int> burst{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    auto sent = tx.send_batch(burst.begin(), burst.end());
+    REQUIRE(sent.isOk());
+    // the ring holds 8 elements, so the remainder of the burst is refused
+    REQUIRE(sent.value() == 8);
+    std::vector<int> drained;
+    auto received = rx.recv_batch(std::back_inserter(drained), 64);
+    REQUIRE(received.isOk());
+    REQUIRE(received.value() == 8);
+    REQUIRE(drained == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7});
+
+    auto [ltx, lrx] = channel<int, ChannelType::UnboundedLockFree>();
+    std::vector<int> all{10, 11, 12, 13};
+    REQUIRE(ltx.send_batch(all.begin(), all.end()).value() == 4);
+    drained.clear();
+    REQUIRE(lrx.recv_batch(std::back_inserter(drained), 3).value() == 3);
+    REQUIRE(lrx.recv_batch(std::back_inserter(drained), 3).value() == 1);
+    REQUIRE(drained == std::vector<int>{10, 11, 12, 13});
+}
+
+TEST_CASE("Blocking recv parks until a value arrives", "[mpsc]")
+{
+    auto [tx, rx] = channel<int, ChannelType::UnboundedLockFree>();
+    auto producer = std::thread([tx]() mutable {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        static_cast<void>(tx.send(42));
+    });
+    auto res = rx.recv_blocking();
+    REQUIRE(res.isOk());
+    REQUIRE(res.value() == 42);
+    producer.join();
+    REQUIRE(rx.recv_timeout(std::chrono::milliseconds(5)).containsErr(MpscError::EmptyQueue));
+}
+
+TEST_CASE("Node pool recycles node storage within a thread", "[mpsc]")
+{
+    struct Probe
+    {
+        int X;
+    };
+    auto *a = aid::mpsc::detail::NodePool<Probe>::allocate();
+    aid::mpsc::detail::NodePool<Probe>::deallocate(a);
+    auto *b = aid::mpsc::detail::NodePool<Probe>::allocate();
+    // the freelist hands back the cached storage instead of hitting the heap
+    REQUIRE(a == b);
+    aid::mpsc::detail::NodePool<Probe>::deallocate(b);
+}
+
+TEST_CASE("channel_with_capacity pre-reserves storage", "[mpsc]")
+{
+    auto [tx, rx] = channel_with_capacity<int, ChannelType::UnboundedLockFree>(128);
+    for (int i = 0; i < 128; ++i) {
+        REQUIRE(tx.send(std::move(i)).isOk());
+    }
+    for (int i = 0; i < 128; ++i) {
+        REQUIRE(rx.recv().value() == i);
+    }
+    auto [btx, brx] = channel_with_capacity<int, ChannelType::BoundedSpsc>(16);
+    for (int i = 0; i < 16; ++i) {
+        REQUIRE(btx.send(std::move(i)).isOk());
+    }
+    REQUIRE(btx.send(16).isErr());
+    static_cast<void>(brx);
+}
+
+TEST_CASE("Work-stealing channel drains one channel across many consumers", "[mpsc]")
+{
+    constexpr int n = 20000;
+    auto [tx, rx0] = channel<int, ChannelType::MpmcWorkStealing>();
+    std::atomic<int> received{0};
+    std::atomic<long long> sum{0};
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < 4; ++c) {
+        consumers.emplace_back([rx = rx0.clone(), &received, &sum]() mutable {
+            while (received.load() < n) {
+                auto res = rx.recv();
+                if (res.isOk()) {
+                    sum.fetch_add(res.value());
+                    received.fetch_add(1);
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int i = 0; i < n; ++i) {
+        static_cast<void>(tx.send(std::move(i)));
+    }
+    for (auto &t : consumers) { t.join(); }
+    // message conservation: every element arrived exactly once across all consumers
+    REQUIRE(received.load() == n);
+    REQUIRE(sum.load() == static_cast<long long>(n) * (n - 1) / 2);
+}
+
+TEST_CASE("OneShot cell carries exactly one value", "[mpsc]")
+{
+    auto [tx, rx] = channel<std::string, ChannelType::OneShot>();
+    REQUIRE(tx.send("done").isOk());
+    // the cell was used, a second send fails instead of overwriting
+    REQUIRE(tx.send("again").isErr());
+    auto res = rx.recv();
+    REQUIRE(res.isOk());
+    REQUIRE(res.value() == "done");
+    REQUIRE(rx.recv().containsErr(MpscError::EmptyQueue));
+}
+
+TEST_CASE("Arena-backed channels live in caller-provided storage", "[mpsc]")
+{
+    alignas(64) std::byte storage[4096];
+    aid::mpsc::Arena arena{storage, sizeof(storage)};
+    auto before = arena.remaining();
+    auto [tx, rx] = channel_in<int, ChannelType::BoundedSpsc>(arena, 16);
+    // queue state and the slot buffer both came out of the arena
+    REQUIRE(arena.remaining() < before);
+    for (int i = 0; i < 16; ++i) {
+        REQUIRE(tx.send(std::move(i)).isOk());
+    }
+    REQUIRE(tx.send(16).isErr());
+    for (int i = 0; i < 16; ++i) {
+        REQUIRE(rx.recv().value() == i);
+    }
+
+    auto [otx, orx] = channel_in<int>(arena);
+    REQUIRE(otx.send(7).isOk());
+    REQUIRE(orx.recv().value() == 7);
+}
+
+TEST_CASE("Select wakes with the index of the ready channel", "[mpsc]")
+{
+    auto [tx1, rx1] = channel<int, ChannelType::UnboundedLockFree>();
+    auto [tx2, rx2] = channel<int, ChannelType::UnboundedLockFree>();
+    SelectSet select;
+    auto i1 = select.add(rx1);
+    auto i2 = select.add(rx2);
+    // registration marks channels ready once so pre-existing backlog is never missed
+    REQUIRE(select.waitFor(std::chrono::milliseconds(1)).has_value());
+    REQUIRE(select.waitFor(std::chrono::milliseconds(1)).has_value());
+    REQUIRE_FALSE(select.waitFor(std::chrono::milliseconds(1)).has_value());
+
+    auto producer = std::thread([tx2]() mutable {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        static_cast<void>(tx2.send(99));
+    });
+    while (true) {
+        auto ready = select.wait();
+        if (ready == i2) {
+            auto res = rx2.recv();
+            if (res.isOk()) {
+                REQUIRE(res.value() == 99);
+                break;
+            }
+        }
+        else {
+            // spurious or stale readiness on the other channel: drain and select again
+            REQUIRE(ready == i1);
+            static_cast<void>(rx1.recv());
+        }
+    }
+    producer.join();
+}
+
+TEST_CASE("Channel state is padded and audited against false sharing", "[mpsc]")
+{
+    STATIC_REQUIRE(alignof(MpscQueue<int>) >= CacheLineSize);
+    STATIC_REQUIRE(alignof(LockFreeMpscQueue<int>) >= CacheLineSize);
+
+    // a producer and a consumer alternating on the same queue must register as
+    // owner-thread switches in the debug sharing audit
+    MpscQueue<int> queue;
+    auto producer = std::thread([&queue] {
+        for (int i = 0; i < 100; ++i) {
+            static_cast<void>(queue.push(int{i}));
+        }
+    });
+    producer.join();
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(queue.pop().isOk());
+    }
+#ifndef NDEBUG
+    // the sharing audit is compiled out in release builds
+    REQUIRE(queue.auditBounces() > 0);
+#endif
+}
+
+TEST_CASE("Dropping the channel halves is detected as a hangup", "[mpsc]")
+{
+    SECTION("recv reports a disconnect once the last sender is gone")
+    {
+        auto [tx, rx] = channel<int, ChannelType::UnboundedLockFree>();
+        {
+            auto tx2 = tx;// a copy keeps the channel connected
+            static_cast<void>(tx2.send(1));
+        }
+        REQUIRE(rx.recv().value() == 1);
+        REQUIRE(rx.recv().containsErr(MpscError::EmptyQueue));
+        {
+            auto last = std::move(tx);
+            static_cast<void>(last.send(2));
+        }
+        // the value sent just before the hangup is still delivered
+        REQUIRE(rx.recv().value() == 2);
+        REQUIRE(rx.recv().containsErr(MpscError::Sender));
+    }
+
+    SECTION("a blocked consumer wakes when the last sender drops")
+    {
+        auto [tx, rx] = channel<int, ChannelType::UnboundedLockFree>();
+        auto dropper = std::thread([tx = std::move(tx)]() mutable {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            auto gone = std::move(tx);
+        });
+        REQUIRE(rx.recv_blocking().containsErr(MpscError::Sender));
+        dropper.join();
+    }
+
+    SECTION("send fails fast once the receiver is gone")
+    {
+        auto [tx, rx] = channel<int, ChannelType::UnboundedLockFree>();
+        {
+            auto gone = std::move(rx);
+        }
+        auto res = tx.send(7);
+        REQUIRE(res.isErr());
+        REQUIRE(res.err().reason() == MpscError::Receiver);
+        std::vector<int> vals{1, 2, 3};
+        REQUIRE(tx.send_batch(vals.begin(), vals.end()).containsErr(MpscError::Receiver));
+    }
+}
+
+TEST_CASE("Messages can be constructed in place inside the channel", "[mpsc]")
+{
+    auto [tx, rx] = channel<std::string, ChannelType::UnboundedLockFree>();
+    REQUIRE(tx.send_emplace(static_cast<std::size_t>(5), 'x').isOk());
+    REQUIRE(rx.recv().value() == "xxxxx");
+
+    auto [btx, brx] = channel<std::string, ChannelType::BoundedSpsc>(1);
+    REQUIRE(btx.send_emplace("in place").isOk());
+    REQUIRE(btx.send_emplace("overflow").containsErr(MpscError::FullQueue));
+    REQUIRE(brx.recv().value() == "in place");
+
+    auto [otx, orx] = channel<std::string>();
+    REQUIRE(otx.send_emplace("one shot").isOk());
+    REQUIRE(otx.send_emplace("again").containsErr(MpscError::FullQueue));
+    REQUIRE(orx.recv().value() == "one shot");
+}
+
+TEST_CASE("Blocking receives work under every backoff policy", "[mpsc]")
+{
+    auto exchange = [](auto make_channel) {
+        auto [tx, rx] = make_channel();
+        auto producer = std::thread([tx]() mutable {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            static_cast<void>(tx.send(42));
+        });
+        REQUIRE(rx.recv_blocking().value() == 42);
+        producer.join();
+    };
+    exchange([] { return channel<int, ChannelType::UnboundedLockFree, SpinBackoff>(); });
+    exchange([] { return channel<int, ChannelType::UnboundedLockFree, YieldBackoff>(); });
+    exchange([] { return channel<int, ChannelType::UnboundedLockFree, AdaptiveBackoff>(); });
+}
+
+TEST_CASE("Draining detaches the whole backlog in one operation", "[mpsc]")
+{
+    auto [tx, rx] = channel<int, ChannelType::UnboundedLockFree>();
+    std::vector<int> values(1000);
+    for (int i = 0; i < 1000; ++i) { values[static_cast<std::size_t>(i)] = i; }
+    REQUIRE(tx.send_batch(values.begin(), values.end()).value() == 1000);
+
+    auto drained = rx.drain();
+    REQUIRE(drained.size() == 1000);
+    REQUIRE(drained.front() == 0);
+    REQUIRE(drained.back() == 999);
+    REQUIRE(rx.drain().empty());
+
+    // the queue keeps working after the detach
+    REQUIRE(tx.send(5).isOk());
+    long sum = 0;
+    REQUIRE(rx.for_each([&sum](int &&v) { sum += v; }) == 1);
+    REQUIRE(sum == 5);
+
+    auto [btx, brx] = channel<int, ChannelType::BoundedSpsc>(64);
+    for (int i = 0; i < 64; ++i) { static_cast<void>(btx.send(int{i})); }
+    REQUIRE(brx.drain().size() == 64);
+    REQUIRE(btx.send(1).isOk());
+    REQUIRE(brx.recv().value() == 1);
+}
+
+#if defined(AID_HAS_COROUTINES)
+namespace
+{
+struct AwaitTask
+{
+    struct promise_type
+    {
+        auto get_return_object() -> AwaitTask { return {}; }
+        auto initial_suspend() -> std::suspend_never { return {}; }
+        auto final_suspend() noexcept -> std::suspend_never { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+auto consumeOne(Receiver<int, ChannelType::UnboundedLockFree> &rx, std::atomic<int> &got)
+    -> AwaitTask
+{
+    auto res = co_await rx.recv_async();
+    got.store(res.value());
+}
+}// namespace
+
+TEST_CASE("recv_async suspends until a send resumes the coroutine", "[mpsc]")
+{
+    auto [tx, rx] = channel<int, ChannelType::UnboundedLockFree>();
+
+    SECTION("a ready value completes without suspending")
+    {
+        REQUIRE(tx.send(3).isOk());
+        std::atomic<int> got{-1};
+        consumeOne(rx, got);
+        REQUIRE(got.load() == 3);
+    }
+
+    SECTION("an empty channel suspends and the send resumes inline")
+    {
+        std::atomic<int> got{-1};
+        consumeOne(rx, got);
+        REQUIRE(got.load() == -1);
+        REQUIRE(tx.send(7).isOk());
+        REQUIRE(got.load() == 7);
+    }
+}
+#endif
+
+TEST_CASE("Bounded channels apply the configured backpressure policy", "[mpsc]")
+{
+    SECTION("drop-newest rejects the value and keeps the backlog")
+    {
+        auto [tx, rx] = channel<int, ChannelType::BoundedMpsc>(2, FullQueuePolicy::DropNewest);
+        REQUIRE(tx.send(1).isOk());
+        REQUIRE(tx.send(2).isOk());
+        auto res = tx.send(3);
+        REQUIRE(res.isErr());
+        REQUIRE(res.err().reason() == MpscError::FullQueue);
+        REQUIRE(rx.recv().value() == 1);
+        REQUIRE(rx.recv().value() == 2);
+    }
+
+    SECTION("drop-oldest evicts the oldest value to make room")
+    {
+        auto [tx, rx] = channel<int, ChannelType::BoundedMpsc>(2, FullQueuePolicy::DropOldest);
+        REQUIRE(tx.send(1).isOk());
+        REQUIRE(tx.send(2).isOk());
+        REQUIRE(tx.send(3).isOk());
+        REQUIRE(rx.recv().value() == 2);
+        REQUIRE(rx.recv().value() == 3);
+    }
+
+    SECTION("a blocked producer resumes when the consumer makes room")
+    {
+        auto [tx, rx] = channel<int, ChannelType::BoundedMpsc>(1, FullQueuePolicy::Block);
+        REQUIRE(tx.send(1).isOk());
+        auto producer = std::thread([tx]() mutable {
+            static_cast<void>(tx.send(2));// parks until the consumer pops
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        REQUIRE(rx.recv().value() == 1);
+        producer.join();
+        REQUIRE(rx.recv_blocking().value() == 2);
+    }
+
+    SECTION("a blocked producer reports the receiver hangup, not a full queue")
+    {
+        auto pair = channel<int, ChannelType::BoundedMpsc>(1, FullQueuePolicy::Block);
+        auto tx = std::move(pair.first);
+        REQUIRE(tx.send(1).isOk());
+        std::atomic<int> reason{-1};
+        auto producer = std::thread([tx, &reason]() mutable {
+            auto res = tx.send(2);// parks until the receiver drops
+            reason.store(static_cast<int>(res.err().reason()));
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        { auto dropped = std::move(pair.second); }
+        producer.join();
+        REQUIRE(reason.load() == static_cast<int>(MpscError::Receiver));
+    }
+}
+
+TEST_CASE("A failed send hands the value back for an allocation-free retry", "[mpsc]")
+{
+    auto [tx, rx] = channel<std::string, ChannelType::BoundedMpsc>(1, FullQueuePolicy::DropNewest);
+    REQUIRE(tx.send(std::string{"first"}).isOk());
+    auto res = tx.send(std::string(64, 'x'));
+    REQUIRE(res.isErr());
+    auto recovered = std::move(res.err()).into_value();
+    REQUIRE(recovered == std::string(64, 'x'));
+    REQUIRE(rx.recv().value() == "first");
+    // the recovered value is retried without a copy having been kept on the side
+    REQUIRE(tx.send(std::move(recovered)).isOk());
+    REQUIRE(rx.recv().value() == std::string(64, 'x'));
+}
+
+TEST_CASE("Channel statistics merge per-thread counters on read", "[mpsc]")
+{
+    MpscQueue<int> queue;
+    static_cast<void>(queue.pop());// empty pop
+    for (int i = 0; i < 5; ++i) { static_cast<void>(queue.push(int{i})); }
+    for (int i = 0; i < 5; ++i) { static_cast<void>(queue.pop()); }
+    auto stats = queue.stats();
+#if defined(AID_CHANNEL_STATS)
+    REQUIRE(stats.Enqueued == 5);
+    REQUIRE(stats.Dequeued == 5);
+    REQUIRE(stats.EmptyPops == 1);
+    REQUIRE(stats.MaxDepth == 5);
+#else
+    // without the build flag the recorder is a no-op and the snapshot stays zero
+    REQUIRE(stats.Enqueued == 0);
+    REQUIRE(stats.MaxDepth == 0);
+#endif
+
+    // the batch paths count every element, not one event per call
+    int batch[3] = {7, 8, 9};
+    static_cast<void>(queue.push_batch(batch, batch + 3));
+    std::vector<int> drained;
+    static_cast<void>(queue.drain_all(std::back_inserter(drained)));
+    REQUIRE(drained.size() == 3);
+    auto after = queue.stats();
+#if defined(AID_CHANNEL_STATS)
+    REQUIRE(after.Enqueued == 8);
+    REQUIRE(after.Dequeued == 8);
+#else
+    REQUIRE(after.Dequeued == 0);
+#endif
+}
+
+namespace
+{
+struct Tick
+{
+    double Price;
+    long Volume;
+};
+}// namespace
+
+TEST_CASE("Trivially copyable payloads take the raw-copy ring path", "[mpsc]")
+{
+    STATIC_REQUIRE(std::is_trivially_copyable_v<Tick>);
+    SpscRingBuffer<Tick> ring{8};
+
+    // advance the indices so the batch below wraps around the physical end
+    for (int i = 0; i < 6; ++i) {
+        REQUIRE(ring.push(Tick{1.0 * i, i}).isOk());
+        REQUIRE(ring.pop().isOk());
+    }
+
+    Tick in[5];
+    for (int i = 0; i < 5; ++i) { in[i] = Tick{10.0 + i, 100 + i}; }
+    REQUIRE(ring.push_batch(static_cast<Tick *>(in), in + 5).value() == 5);
+
+    Tick out[5] = {};
+    REQUIRE(ring.pop_batch(static_cast<Tick *>(out), 5).value() == 5);
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(out[i].Price == 10.0 + i);
+        REQUIRE(out[i].Volume == 100 + i);
+    }
+    REQUIRE(ring.pop().containsErr(MpscError::EmptyQueue));
+}
+
+TEST_CASE("Topology helpers wire fan-in, fan-out and shard routing", "[mpsc]")
+{
+    SECTION("fan-in merges sources and reports a full disconnect")
+    {
+        std::vector<Receiver<int, ChannelType::UnboundedLockFree>> sources;
+        std::vector<Sender<int, ChannelType::UnboundedLockFree>> txs;
+        for (int s = 0; s < 3; ++s) {
+            auto [tx, rx] = channel<int, ChannelType::UnboundedLockFree>();
+            txs.push_back(std::move(tx));
+            sources.push_back(std::move(rx));
+        }
+        auto merged = fan_in(std::move(sources));
+        for (int s = 0; s < 3; ++s) {
+            REQUIRE(txs[s].send(100 * s + 1).isOk());
+            REQUIRE(txs[s].send(100 * s + 2).isOk());
+        }
+        int sum = 0;
+        for (int i = 0; i < 6; ++i) {
+            sum += merged.recv_blocking().value();
+        }
+        REQUIRE(sum == 1 + 2 + 101 + 102 + 201 + 202);
+        REQUIRE(merged.recv().containsErr(MpscError::EmptyQueue));
+        txs.clear();
+        REQUIRE(merged.recv_blocking().containsErr(MpscError::Sender));
+    }
+
+    SECTION("fan-out keeps one key on one shard, in order")
+    {
+        auto split = fan_out<int>(4, [](const int &value) { return value; });
+        for (int i = 0; i < 40; ++i) {
+            REQUIRE(split.send(int{i}).isOk());
+        }
+        for (std::size_t s = 0; s < split.shards(); ++s) {
+            auto values = split.receivers()[s].drain();
+            REQUIRE(values.size() == 10);
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                REQUIRE(static_cast<std::size_t>(values[i]) % 4 == s);
+                if (i > 0) { REQUIRE(values[i - 1] < values[i]); }
+            }
+        }
+    }
+
+    SECTION("shard router pins each producer thread to one sub-queue")
+    {
+        ShardRouter<int> router{2};
+        REQUIRE(router.myShard() == router.myShard());
+        std::thread producer{[&router] {
+            for (int i = 0; i < 50; ++i) {
+                static_cast<void>(router.send(int{i}));
+            }
+        }};
+        producer.join();
+        for (int i = 0; i < 50; ++i) {
+            static_cast<void>(router.send(int{100 + i}));
+        }
+        std::size_t total = 0;
+        for (auto &rx : router.receivers()) {
+            auto values = rx.drain();
+            // everything a thread sent went through its single pinned shard
+            if (!values.empty()) {
+                REQUIRE(values.size() == 50);
+                for (std::size_t i = 1; i < values.size(); ++i) {
+                    REQUIRE(values[i - 1] < values[i]);
+                }
+            }
+            total += values.size();
+        }
+        REQUIRE(total == 100);
+    }
+}
+
+namespace
+{
+struct Event
+{
+    std::uint64_t Ts;
+    int Core;
+};
+}// namespace
+
+TEST_CASE("Ordered-merge channel delivers timestamped streams in global order", "[mpsc]")
+{
+    constexpr int producers = 4;
+    constexpr std::uint64_t per_producer = 250;
+    auto [tx, rx] = ordered_channel<Event>(
+        producers, [](const Event &e) { return e.Ts; });
+
+    SECTION("quiescent lanes merge into one monotone stream")
+    {
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([tx, p]() mutable {
+                for (std::uint64_t i = 0; i < per_producer; ++i) {
+                    static_cast<void>(
+                        tx.send(Event{i * producers + static_cast<std::uint64_t>(p), p}));
+                }
+            });
+        }
+        for (auto &t : threads) { t.join(); }
+        { auto dropped = std::move(tx); }
+
+        std::uint64_t expected = 0;
+        for (; expected < producers * per_producer; ++expected) {
+            auto res = rx.recv();
+            REQUIRE(res.isOk());
+            // every timestamp occurs exactly once, so global order means equality
+            REQUIRE(res.value().Ts == expected);
+        }
+        REQUIRE(rx.recv().containsErr(MpscError::Sender));
+    }
+
+    SECTION("a push into a lane cached as empty re-enters the merge")
+    {
+        std::thread producer{[tx]() mutable {
+            static_cast<void>(tx.send(Event{7, 1}));
+        }};
+        producer.join();
+        REQUIRE(rx.recv().value().Ts == 7);
+        std::thread late{[tx]() mutable {
+            static_cast<void>(tx.send(Event{8, 1}));
+        }};
+        late.join();
+        REQUIRE(rx.recv_blocking().value().Ts == 8);
+    }
+}
@@ -1,4 +1,5 @@
 #include <aid/core/result.hpp>
+#include <array>
 #include <catch2/catch.hpp>
 #include <iostream>
 
@@ -152,4 +153,157 @@ TEST_CASE("Contains in a Result", "[Result]") {
 TEST_CASE("Expect a value or error in a Result", "[Result]") {
     REQUIRE(ok<int, int>(3).expect("not printed") == 3);
     REQUIRE(err<int, int>(3).expectErr("not printed") == 3);
-}
\ No newline at end of file
+}
+TEST_CASE("Result stores a single payload slot", "[Result]") {
+    using Payload = std::array<char, 64>;
+    // A Result holds one live side at a time, so the footprint is a single
+    // payload slot plus a tag instead of two optionals side by side.
+    REQUIRE(sizeof(Result<Payload, int>) < sizeof(std::optional<Payload>) + sizeof(std::optional<int>));
+}
+
+TEST_CASE("Observe a Result without consuming it", "[Result]") {
+    auto res1 = ok<std::vector<int>, std::string>(std::vector{1, 2, 3});
+    REQUIRE(res1.valueRef().size() == 3);
+    res1.valueRef().push_back(4);
+    REQUIRE(res1.valueRef().size() == 4);
+    // the Result is still intact after borrowing
+    REQUIRE(res1.isOk());
+
+    auto res2 = err<int, std::string>("broken");
+    REQUIRE(res2.errRef() == "broken");
+    REQUIRE(res2.isErr());
+
+    int seen = 0;
+    auto res3 = ok<int, std::string>(7);
+    res3.inspect([&seen](const int &v) { seen = v; }).inspectErr([&seen](const std::string &) { seen = -1; });
+    REQUIRE(seen == 7);
+    REQUIRE(res3.isOk());
+
+    const auto res4 = ok<int, std::string>(5);
+    auto res5 = res4.map([](const int &v) { return v * 2; });
+    REQUIRE(res5.value() == 10);
+    // the const map overload leaves the source untouched
+    REQUIRE(res4.isOk());
+    const auto res6 = err<int, std::string>("still here");
+    auto res7 = res6.map([](const int &v) { return v * 2; });
+    REQUIRE(res7.isErr());
+    REQUIRE(res6.errRef() == "still here");
+}
+
+TEST_CASE("Result chains fold away at compile time", "[Result]") {
+    constexpr auto res = ok<int, int>(5);
+    static_assert(res.isOk());
+    static_assert(!res.isErr());
+    static_assert(res.contains(5));
+    // whole validation chains evaluate during constant evaluation
+    constexpr bool mapped = ok<int, int>(2).map([](int &&v) { return v * 2; }).contains(4);
+    static_assert(mapped);
+    constexpr bool propagated = err<int, int>(3).map([](int &&v) { return v * 2; }).containsErr(3);
+    static_assert(propagated);
+    REQUIRE(mapped);
+    REQUIRE(propagated);
+}
+
+TEST_CASE("Status-only results carry no payload for the Ok state", "[result]")
+{
+    auto good = aid::core::ok<void, int>();
+    REQUIRE(good.isOk());
+    REQUIRE_FALSE(good.isErr());
+    good.value();
+    REQUIRE_FALSE(good.isOk());
+
+    auto bad = aid::core::err<void, int>(7);
+    REQUIRE(bad.isErr());
+    REQUIRE(bad.containsErr(7));
+    REQUIRE(bad.errRef() == 7);
+    auto chained = bad.mapErr([](int &&e) { return e + 1; });
+    REQUIRE(chained.err() == 8);
+
+    auto mapped = aid::core::ok<void, int>().map([] { return std::string{"done"}; });
+    REQUIRE(mapped.value() == "done");
+    auto threaded = aid::core::ok<void, int>().andThen([] { return aid::core::ok<void, int>(); });
+    REQUIRE(threaded.isOk());
+
+    // the Ok state is just the tag: no bigger than the same Result over a dummy payload
+    STATIC_REQUIRE(sizeof(aid::core::Result<void, int>) <= sizeof(aid::core::Result<char, int>));
+}
+
+TEST_CASE("Result failure handling is funneled off the fast path", "[result]")
+{
+    // the funnel itself is shared across instantiations; here we only pin down that
+    // the happy paths still behave after the refactoring
+    auto res = ok<int, std::string>(3);
+    REQUIRE(res.expect("must hold a value") == 3);
+    auto bad = err<int, std::string>(std::string{"broken"});
+    REQUIRE(bad.expectErr("must hold an error") == "broken");
+    aid::core::ok<void, int>().expect("status must be ok");
+}
+
+#include <aid/core/try.hpp>
+
+namespace
+{
+auto parse_positive(int raw) -> aid::core::Result<int, std::string>
+{
+    if (raw <= 0) { return aid::core::err<int, std::string>(std::string{"not positive"}); }
+    return aid::core::ok<int, std::string>(std::move(raw));
+}
+
+auto validate(int raw) -> aid::core::Result<void, std::string>
+{
+    if (raw > 100) { return aid::core::err<void, std::string>(std::string{"too large"}); }
+    return aid::core::ok<void, std::string>();
+}
+
+auto parse_and_double(int raw) -> aid::core::Result<int, std::string>
+{
+    AID_TRY(validate(raw));
+    AID_TRY_ASSIGN(value, parse_positive(raw));
+    AID_TRY_ASSIGN(doubled, parse_positive(value * 2));
+    return aid::core::ok<int, std::string>(std::move(doubled));
+}
+}// namespace
+
+TEST_CASE("AID_TRY propagates errors without lambdas", "[result]")
+{
+    REQUIRE(parse_and_double(21).value() == 42);
+    REQUIRE(parse_and_double(-3).err() == "not positive");
+    REQUIRE(parse_and_double(500).err() == "too large");
+}
+
+#include <aid/core/result_vec.hpp>
+
+TEST_CASE("ResultVec keeps payloads contiguous and validity in a bitmap", "[result]")
+{
+    std::vector<int> raw(130);
+    for (int i = 0; i < 130; ++i) { raw[static_cast<std::size_t>(i)] = i; }
+    // reject the two records divisible by 100 (0 and 100)
+    auto batch = aid::core::map_n(raw.data(), raw.size(), [](const int &v) {
+        if (v % 100 == 0) { return aid::core::err<int, std::string>(std::string{"divisible"}); }
+        return aid::core::ok<int, std::string>(int{v});
+    });
+
+    REQUIRE(batch.size() == 130);
+    REQUIRE(batch.okCount() == 128);
+    REQUIRE(batch.errCount() == 2);
+    REQUIRE_FALSE(batch.isOk(0));
+    REQUIRE(batch.isOk(1));
+    REQUIRE_FALSE(batch.isOk(100));
+    REQUIRE(batch.validity().size() == 3);
+
+    long sum = 0;
+    std::size_t visited = 0;
+    batch.forEachOk([&](int &v) {
+        sum += v;
+        ++visited;
+    });
+    REQUIRE(visited == 128);
+    REQUIRE(sum == 129L * 130 / 2 - 100);
+
+    REQUIRE(batch.allOk().isErr());
+    REQUIRE(batch.errors().front().first == 0);
+
+    aid::core::ResultVec<int, std::string> clean;
+    clean.pushOk(1);
+    REQUIRE(clean.allOk().isOk());
+}
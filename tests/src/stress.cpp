@@ -0,0 +1,240 @@
+/**
+ * Stress/soak harness for the mpsc channels.
+ *
+ * Runs a matrix of producer counts, payload sizes and arrival schedules against the
+ * multi-producer backends, checks FIFO-per-producer ordering and message
+ * conservation, and writes one CSV row per configuration with throughput and p99
+ * end-to-end latency. The process exits non-zero when any configuration loses,
+ * duplicates or reorders a message, so the smoke run registered with CTest catches
+ * queue regressions; longer soak runs raise --messages.
+ */
+#include <aid/mpsc/mpsc.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+/// Message with a fixed amount of payload ballast behind the bookkeeping header.
+template<std::size_t FillBytes>
+struct Payload
+{
+    std::uint32_t Producer{0};
+    std::uint32_t Seq{0};
+    Clock::time_point SentAt{};
+    std::array<char, FillBytes> Fill{};
+};
+
+enum class Schedule
+{
+    /// Producers send back to back.
+    Steady,
+    /// Producers send bursts of 256 separated by a short pause.
+    Bursty
+};
+
+auto scheduleName(Schedule sched) -> const char *
+{
+    return sched == Schedule::Steady ? "steady" : "bursty";
+}
+
+/// Outcome of one configuration of the matrix.
+struct Report
+{
+    std::string Backend;
+    std::size_t Producers{0};
+    std::size_t PayloadBytes{0};
+    Schedule Sched{Schedule::Steady};
+    std::size_t Messages{0};
+    double Seconds{0.0};
+    double P99LatencyUs{0.0};
+    bool FifoOk{false};
+    bool Conserved{false};
+};
+
+/**
+ * Run one configuration: spawn the producers, consume everything on the calling
+ * thread and validate ordering and conservation on the fly.
+ * @param backend backend label for the report
+ * @param producers number of producer threads
+ * @param per_producer messages each producer sends
+ * @param sched arrival schedule the producers follow
+ * @param make_channel factory creating the Sender/Receiver pair under test
+ * @return Report of this configuration.
+ */
+template<typename P, typename Factory>
+auto runConfig(const char *backend, std::size_t producers, std::size_t per_producer,
+               Schedule sched, Factory make_channel) -> Report
+{
+    auto pair = make_channel();
+    auto rx = std::move(pair.second);
+    auto total = producers * per_producer;
+
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+    auto start = Clock::now();
+    {
+        auto tx = std::move(pair.first);
+        for (std::uint32_t p = 0; p < producers; ++p) {
+            threads.emplace_back([tx, p, per_producer, sched]() mutable {
+                for (std::uint32_t i = 1; i <= per_producer; ++i) {
+                    P msg{};
+                    msg.Producer = p;
+                    msg.Seq = i;
+                    msg.SentAt = Clock::now();
+                    for (;;) {
+                        auto res = tx.send(std::move(msg));
+                        if (res.isOk()) {
+                            break;
+                        }
+                        auto failed = res.err();
+                        if (failed.reason() == aid::mpsc::MpscError::Receiver) {
+                            return;
+                        }
+                        msg = std::move(failed).into_value();
+                        std::this_thread::yield();
+                    }
+                    if (sched == Schedule::Bursty && i % 256 == 0) {
+                        std::this_thread::sleep_for(std::chrono::microseconds(200));
+                    }
+                }
+            });
+        }
+    }
+
+    std::vector<std::uint32_t> last(producers, 0);
+    std::vector<double> latencies;
+    latencies.reserve(total);
+    bool fifo_ok = true;
+    std::size_t received = 0;
+    while (received < total) {
+        auto res = rx.recv_blocking();
+        if (res.isErr()) {
+            break;
+        }
+        auto msg = res.value();
+        auto now = Clock::now();
+        latencies.push_back(
+            std::chrono::duration<double, std::micro>(now - msg.SentAt).count());
+        if (msg.Seq != last[msg.Producer] + 1) {
+            fifo_ok = false;
+        }
+        last[msg.Producer] = msg.Seq;
+        ++received;
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    bool conserved = received == total;
+    for (auto seq : last) {
+        conserved = conserved && seq == per_producer;
+    }
+    double p99 = 0.0;
+    if (!latencies.empty()) {
+        auto idx = latencies.size() * 99 / 100;
+        if (idx == latencies.size()) {
+            --idx;
+        }
+        std::nth_element(latencies.begin(), latencies.begin() + idx, latencies.end());
+        p99 = latencies[idx];
+    }
+    return Report{backend, producers, sizeof(P), sched, received, seconds, p99,
+                  fifo_ok, conserved};
+}
+
+/**
+ * Run the producer-count and schedule matrix for one payload size over both
+ * multi-producer backends.
+ * @param per_producer messages each producer sends
+ * @param out collected reports
+ */
+template<typename P>
+void runPayload(std::size_t per_producer, std::vector<Report> &out)
+{
+    constexpr std::size_t producer_counts[] = {1, 4, 16, 64};
+    constexpr Schedule schedules[] = {Schedule::Steady, Schedule::Bursty};
+    for (auto producers : producer_counts) {
+        for (auto sched : schedules) {
+            out.push_back(runConfig<P>("unbounded_lock_free", producers, per_producer,
+                                       sched, [] {
+                return aid::mpsc::channel<P, aid::mpsc::ChannelType::UnboundedLockFree>();
+            }));
+            out.push_back(runConfig<P>("bounded_mpsc", producers, per_producer, sched,
+                                       [] {
+                return aid::mpsc::channel<P, aid::mpsc::ChannelType::BoundedMpsc>(
+                    1024, aid::mpsc::FullQueuePolicy::Block);
+            }));
+        }
+    }
+}
+
+void writeReports(std::ostream &os, const std::vector<Report> &reports)
+{
+    os << "backend,producers,payload_bytes,schedule,messages,seconds,"
+          "throughput_msgs_per_sec,p99_latency_us,fifo_ok,conserved\n";
+    for (const auto &r : reports) {
+        auto throughput = r.Seconds > 0.0 ? static_cast<double>(r.Messages) / r.Seconds
+                                          : 0.0;
+        os << r.Backend << ',' << r.Producers << ',' << r.PayloadBytes << ','
+           << scheduleName(r.Sched) << ',' << r.Messages << ',' << r.Seconds << ','
+           << throughput << ',' << r.P99LatencyUs << ',' << (r.FifoOk ? 1 : 0) << ','
+           << (r.Conserved ? 1 : 0) << '\n';
+    }
+}
+}// namespace
+
+auto main(int argc, char **argv) -> int
+{
+    std::size_t per_producer = 10000;
+    std::string output;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{argv[i]};
+        if (arg == "--messages" && i + 1 < argc) {
+            per_producer = static_cast<std::size_t>(std::stoull(argv[++i]));
+        }
+        else if (arg == "--output" && i + 1 < argc) {
+            output = argv[++i];
+        }
+        else {
+            std::cerr << "usage: " << argv[0]
+                      << " [--messages per_producer] [--output report.csv]"
+                      << std::endl;
+            return 2;
+        }
+    }
+
+    std::vector<Report> reports;
+    runPayload<Payload<8>>(per_producer, reports);
+    runPayload<Payload<48>>(per_producer, reports);
+    runPayload<Payload<240>>(per_producer, reports);
+
+    if (output.empty()) {
+        writeReports(std::cout, reports);
+    }
+    else {
+        std::ofstream os{output};
+        writeReports(os, reports);
+    }
+
+    for (const auto &r : reports) {
+        if (!r.FifoOk || !r.Conserved) {
+            std::cerr << "FAILED: " << r.Backend << " producers=" << r.Producers
+                      << " payload=" << r.PayloadBytes << " schedule="
+                      << scheduleName(r.Sched) << (r.FifoOk ? "" : " reordered")
+                      << (r.Conserved ? "" : " lost/duplicated") << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}